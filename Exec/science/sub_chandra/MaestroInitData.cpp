@@ -66,37 +66,14 @@ void Maestro::InitLevelDataSphr(const int lev, const Real time, MultiFab& scal,
     // then initialize h from rho, X, and p0.
     MultiFab p0_cart(scal.boxArray(), scal.DistributionMap(), 1, 0);
 
-    // make a temporary MultiFab and RealVector to hold the cartesian data then copy it back to scal
-    MultiFab temp_mf(scal.boxArray(), scal.DistributionMap(), 1, 0);
-
-    BaseState<Real> temp_vec(base_geom.max_radial_level + 1, base_geom.nr_fine);
-    auto temp_arr = temp_vec.array();
-
-    const auto s0_arr = s0_init.const_array();
-
-    // initialize temperature
-    for (auto l = 0; l <= base_geom.max_radial_level; ++l) {
-        for (auto r = 0; r < base_geom.nr_fine; ++r) {
-            temp_arr(l, r) = s0_arr(l, r, Temp);
-        }
-    }
-
-    Put1dArrayOnCart(lev, temp_vec, temp_mf, 0, 0, bcs_f, 0);
-    MultiFab::Copy(scal, temp_mf, 0, Temp, 1, 0);
+    // initialize temperature and species
+    Put1dArrayOnCart(lev, s0_init, scal, Temp, Temp, 1);
+    Put1dArrayOnCart(lev, s0_init, scal, FirstSpec, FirstSpec, NumSpec);
 
     // initialize p0_cart
     Put1dArrayOnCart(lev, p0_init, p0_cart, 0, 0);
 
-    // initialize species
-    for (auto comp = 0; comp < NumSpec; ++comp) {
-        for (auto l = 0; l <= base_geom.max_radial_level; ++l) {
-            for (auto r = 0; r < base_geom.nr_fine; ++r) {
-                temp_arr(l, r) = s0_arr(l, r, FirstSpec + comp);
-            }
-        }
-        Put1dArrayOnCart(lev, temp_vec, temp_mf, 0, 0, bcs_s, FirstSpec + comp);
-        MultiFab::Copy(scal, temp_mf, 0, FirstSpec + comp, 1, 0);
-    }
+    const auto s0_arr = s0_init.const_array();
 
     // compute the radial bounds of the perturbation
     Real velpert_r_outer;
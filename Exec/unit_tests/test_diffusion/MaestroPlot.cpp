@@ -29,12 +29,12 @@ void Maestro::WritePlotFile(const int step, const Real t_in, const Real dt_in,
 
     // make plot mfs
     const Vector<MultiFab> dummy;
-    const auto& state_mf = PlotFileMF(nPlot, 0, dt_in, state, dummy, dummy,
-                                      dummy, dummy, analytic, b, b, dummy);
-    const auto& analytic_mf = PlotFileMF(nPlot, 1, dt_in, dummy, dummy, dummy,
-                                         dummy, dummy, analytic, b, b, dummy);
-    const auto& error_mf = PlotFileMF(nPlot, 2, dt_in, err, dummy, dummy, dummy,
-                                      dummy, analytic, b, b, dummy);
+    const auto& state_mf =
+        PlotFileMF(nPlot, 0, dt_in, a, b, c, d, state, analytic, dummy);
+    const auto& analytic_mf =
+        PlotFileMF(nPlot, 1, dt_in, a, b, c, d, dummy, analytic, dummy);
+    const auto& error_mf =
+        PlotFileMF(nPlot, 2, dt_in, a, b, c, d, err, analytic, dummy);
 
     // WriteMultiLevelPlotfile expects an array of step numbers
     Vector<int> step_array;
@@ -64,10 +64,9 @@ void Maestro::PlotFileName(const int lev, std::string* plotfilename) {
 // put together a vector of multifabs for writing
 Vector<const MultiFab*> Maestro::PlotFileMF(
     const int nPlot, const Real t_in, const Real dt_in,
-    const Vector<MultiFab>& s_in, const Vector<MultiFab>& h,
-    const Vector<MultiFab>& j, const Vector<MultiFab>& a,
-    const Vector<MultiFab>& b, Vector<MultiFab>& analytic,
-    const BaseState<Real>& d, const BaseState<Real>& e,
+    const BaseState<Real>& a, const BaseState<Real>& b,
+    const BaseState<Real>& c, const BaseState<Real>& d,
+    const Vector<MultiFab>& s_in, Vector<MultiFab>& analytic,
     const Vector<MultiFab>& f) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::PlotFileMF()", PlotFileMF);
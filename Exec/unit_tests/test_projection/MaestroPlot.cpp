@@ -41,8 +41,8 @@ void Maestro::WritePlotFile(const int step, const Real t_in, const Real dt_in,
 
     if (step == 2) {
         const Vector<std::string> varnames = {"gphix", "gphiy", "gphiz"};
-        const auto& mf = PlotFileMF(nPlot, t_in, dt_in, dummy, dummy, dummy,
-                                    dummy, u_in, e, b, b, dummy);
+        const auto& mf =
+            PlotFileMF(nPlot, t_in, dt_in, a, b, c, d, u_in, e, dummy);
         WriteMultiLevelPlotfile(plotfilename, finest_level + 1, mf, varnames,
                                 Geom(), t_in, step_array, refRatio());
 
@@ -52,8 +52,8 @@ void Maestro::WritePlotFile(const int step, const Real t_in, const Real dt_in,
 
     } else {
         const auto& varnames = PlotFileVarNames(&nPlot);
-        const auto& mf = PlotFileMF(nPlot, t_in, dt_in, dummy, dummy, dummy,
-                                    dummy, u_in, e, b, b, dummy);
+        const auto& mf =
+            PlotFileMF(nPlot, t_in, dt_in, a, b, c, d, u_in, e, dummy);
 
         WriteMultiLevelPlotfile(plotfilename, finest_level + 1, mf, varnames,
                                 Geom(), t_in, step_array, refRatio());
@@ -72,10 +72,10 @@ void Maestro::PlotFileName(const int lev, std::string* plotfilename) {
 // put together a vector of multifabs for writing
 Vector<const MultiFab*> Maestro::PlotFileMF(
     const int nPlot, const Real t_in, const Real dt_in,
-    const Vector<MultiFab>& a, const Vector<MultiFab>& b,
-    const Vector<MultiFab>& c, const Vector<MultiFab>& d,
-    const Vector<MultiFab>& u_in, Vector<MultiFab>& e, const BaseState<Real>& f,
-    const BaseState<Real>& g, const Vector<MultiFab>& h) {
+    const BaseState<Real>& a, const BaseState<Real>& b,
+    const BaseState<Real>& c, const BaseState<Real>& d,
+    const Vector<MultiFab>& u_in, Vector<MultiFab>& e,
+    const Vector<MultiFab>& h) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::PlotFileMF()", PlotFileMF);
 
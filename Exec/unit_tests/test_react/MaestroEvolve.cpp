@@ -59,6 +59,64 @@ void Maestro::Evolve() {
     WritePlotFile(-4, t_new, dt, dummy, dummy, dummy, dummy, rho_omegadot,
                   rho_Hnuc, rho_Hext);
 
+    // Check that overlapping the level 0 ghost cell exchange with the burn
+    // (overlap_burn_fill) does not change the result.  S_cc is computed
+    // from the burned state, so it also checks that the EOS fields cached
+    // for snew (see eos_cache_fields) are refreshed by the burn: snew is
+    // first set to the unburned state and S_cc computed from it.
+    Print() << "\nChecking overlap_burn_fill\n";
+    {
+        const auto obf = overlap_burn_fill;
+
+        Vector<MultiFab> S_cc_ref(finest_level + 1);
+        Vector<MultiFab> S_cc(finest_level + 1);
+        Vector<MultiFab> delta_gamma1_term(finest_level + 1);
+        Vector<MultiFab> delta_gamma1(finest_level + 1);
+        Vector<MultiFab> thermal(finest_level + 1);
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            S_cc_ref[lev].define(grids[lev], dmap[lev], 1, 0);
+            S_cc[lev].define(grids[lev], dmap[lev], 1, 0);
+            delta_gamma1_term[lev].define(grids[lev], dmap[lev], 1, 1);
+            delta_gamma1[lev].define(grids[lev], dmap[lev], 1, 1);
+            thermal[lev].define(grids[lev], dmap[lev], 1, 0);
+            thermal[lev].setVal(0.);
+        }
+        BaseState<Real> delta_gamma1_termbar(base_geom.max_radial_level + 1,
+                                             base_geom.nr_fine);
+
+        for (int overlap = 0; overlap <= 1; ++overlap) {
+            Vector<MultiFab>& S_cc_out = overlap ? S_cc : S_cc_ref;
+
+            do_burning = false;
+            do_heating = false;
+            React(sold, snew, rho_Hext, rho_omegadot, rho_Hnuc, p0_old, dt,
+                  t_old);
+            Make_S_cc(S_cc_out, delta_gamma1_term, delta_gamma1, snew, uold,
+                      rho_omegadot, rho_Hnuc, rho_Hext, thermal, p0_old,
+                      gamma1bar_old, delta_gamma1_termbar);
+
+            do_burning = true;
+            do_heating = dho;
+            overlap_burn_fill = overlap;
+            React(sold, snew, rho_Hext, rho_omegadot, rho_Hnuc, p0_old, dt,
+                  t_old);
+            Make_S_cc(S_cc_out, delta_gamma1_term, delta_gamma1, snew, uold,
+                      rho_omegadot, rho_Hnuc, rho_Hext, thermal, p0_old,
+                      gamma1bar_old, delta_gamma1_termbar);
+        }
+        overlap_burn_fill = obf;
+
+        Real diff = 0.0;
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::Subtract(S_cc[lev], S_cc_ref[lev], 0, 0, 1, 0);
+            diff = amrex::max(diff, S_cc[lev].norm0());
+        }
+        if (diff > 0.0) {
+            Abort("overlap_burn_fill changes S_cc by " + std::to_string(diff));
+        }
+        Print() << "overlap_burn_fill gives the same S_cc\n";
+    }
+
     // Explore ten orders of magnitude of the time domain using user inputs.
     do_burning = dbo;
     do_heating = dho;
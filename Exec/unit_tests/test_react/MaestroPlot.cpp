@@ -45,9 +45,8 @@ void Maestro::WritePlotFile(const int step, const Real t_in, const Real dt_in,
 
     int nPlot = 0;
     const auto& varnames = PlotFileVarNames(&nPlot);
-    const Vector<MultiFab> dummy;
-    const auto& mf = PlotFileMF(nPlot, t_in, dt_in, rho_omegadot, rho_Hnuc,
-                                rho_Hext, dummy, dummy, snew, b, b, dummy);
+    const auto& mf = PlotFileMF(nPlot, t_in, dt_in, a, b, c, d, rho_omegadot,
+                                rho_Hnuc, rho_Hext);
 
     // WriteMultiLevelPlotfile expects an array of step numbers
     Vector<int> step_array;
@@ -81,13 +80,16 @@ void Maestro::PlotFileName(const int lev, std::string* plotfilename) {
 // put together a vector of multifabs for writing
 Vector<const MultiFab*> Maestro::PlotFileMF(
     const int nPlot, const Real t_in, const Real dt_in,
-    const Vector<MultiFab>& rho_omegadot, const Vector<MultiFab>& rho_Hnuc,
-    const Vector<MultiFab>& rho_Hext, const Vector<MultiFab>& a,
-    const Vector<MultiFab>& b, Vector<MultiFab>& s_in, const BaseState<Real>& d,
-    const BaseState<Real>& e, const Vector<MultiFab>& f) {
+    const BaseState<Real>& a, const BaseState<Real>& b,
+    const BaseState<Real>& c, const BaseState<Real>& d,
+    const Vector<MultiFab>& rho_omegadot, Vector<MultiFab>& rho_Hnuc,
+    const Vector<MultiFab>& rho_Hext) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::PlotFileMF()", PlotFileMF);
 
+    // plot the current state
+    const Vector<MultiFab>& s_in = snew;
+
     // MultiFab to hold plotfile data
     Vector<const MultiFab*> plot_mf;
 
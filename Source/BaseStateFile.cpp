@@ -0,0 +1,162 @@
+#include <AMReX.H>
+#include <BaseStateFile.H>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+using namespace amrex;
+
+namespace {
+constexpr char magic[8] = {'M', 'A', 'E', 'S', 'T', 'R', 'O', 'B'};
+constexpr std::uint32_t byte_order_mark = 0x01020304;
+
+// 64-bit FNV-1a hash of size bytes
+std::uint64_t Checksum(const char* buf, const std::size_t size) {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(buf[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+template <typename T>
+void Append(std::string& out, const T val) {
+    out.append(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+// reads the values of a file one after the other, swapping their bytes if
+// the file was written with the other byte order
+struct Reader {
+    const char* buf;
+    std::size_t size;
+    std::size_t pos;
+    bool swap;
+    const std::string& filename;
+
+    void Need(const std::size_t nbytes) const {
+        if (pos + nbytes > size) {
+            Abort("BaseStateFile: " + filename + " is truncated");
+        }
+    }
+
+    template <typename T>
+    T Get() {
+        Need(sizeof(T));
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, buf + pos, sizeof(T));
+        if (swap) {
+            std::reverse(bytes, bytes + sizeof(T));
+        }
+        pos += sizeof(T);
+
+        T val;
+        std::memcpy(&val, bytes, sizeof(T));
+        return val;
+    }
+};
+}  // namespace
+
+void BaseStateFile::Define(const Vector<std::string>& names_in,
+                           const int nlev_in, const int nr_in) {
+    names = names_in;
+    nlev = nlev_in;
+    nrad = nr_in;
+    data.assign(names.size() * nlev * nrad, 0.0);
+}
+
+double* BaseStateFile::Field(const std::string& name) {
+    for (int n = 0; n < int(names.size()); ++n) {
+        if (names[n] == name) {
+            return data.dataPtr() + n * nlev * nrad;
+        }
+    }
+    Abort("BaseStateFile: no base state field " + name);
+    return nullptr;
+}
+
+const double* BaseStateFile::Field(const std::string& name) const {
+    return const_cast<BaseStateFile*>(this)->Field(name);
+}
+
+std::string BaseStateFile::Write() const {
+    std::string out(magic, sizeof(magic));
+
+    Append<std::uint32_t>(out, byte_order_mark);
+    Append<std::int32_t>(out, version);
+    Append<std::int32_t>(out, nlev);
+    Append<std::int32_t>(out, nrad);
+    Append<std::int32_t>(out, names.size());
+    for (const auto& name : names) {
+        Append<std::int32_t>(out, name.size());
+        out.append(name);
+    }
+
+    const char* bytes = reinterpret_cast<const char*>(data.dataPtr());
+    const std::size_t nbytes = data.size() * sizeof(double);
+    Append<std::uint64_t>(out, Checksum(bytes, nbytes));
+    out.append(bytes, nbytes);
+
+    return out;
+}
+
+bool BaseStateFile::IsBinary(const char* buf, const std::size_t size) {
+    return size >= sizeof(magic) &&
+           std::memcmp(buf, magic, sizeof(magic)) == 0;
+}
+
+void BaseStateFile::Read(const char* buf, const std::size_t size,
+                         const std::string& filename) {
+    if (!IsBinary(buf, size)) {
+        Abort("BaseStateFile: " + filename +
+              " is not a binary base state file");
+    }
+
+    Reader in{buf, size, sizeof(magic), false, filename};
+
+    const auto mark = in.Get<std::uint32_t>();
+    if (mark != byte_order_mark) {
+        in.swap = true;
+        in.pos -= sizeof(mark);
+        if (in.Get<std::uint32_t>() != byte_order_mark) {
+            Abort("BaseStateFile: bad byte order mark in " + filename);
+        }
+    }
+
+    const int file_version = in.Get<std::int32_t>();
+    if (file_version < 1 || file_version > version) {
+        Abort("BaseStateFile: " + filename + " has unsupported version " +
+              std::to_string(file_version));
+    }
+
+    nlev = in.Get<std::int32_t>();
+    nrad = in.Get<std::int32_t>();
+    const int nfields = in.Get<std::int32_t>();
+    if (nlev < 0 || nrad < 0 || nfields < 0) {
+        Abort("BaseStateFile: bad header in " + filename);
+    }
+
+    names.resize(nfields);
+    for (auto& name : names) {
+        const int len = in.Get<std::int32_t>();
+        if (len < 0) {
+            Abort("BaseStateFile: bad header in " + filename);
+        }
+        in.Need(len);
+        name.assign(buf + in.pos, len);
+        in.pos += len;
+    }
+
+    const auto checksum = in.Get<std::uint64_t>();
+
+    const std::size_t npts = std::size_t(nfields) * nlev * nrad;
+    in.Need(npts * sizeof(double));
+    if (Checksum(buf + in.pos, npts * sizeof(double)) != checksum) {
+        Abort("BaseStateFile: checksum mismatch in " + filename);
+    }
+
+    data.resize(npts);
+    for (auto& val : data) {
+        val = in.Get<double>();
+    }
+}
@@ -38,17 +38,14 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     Vector<MultiFab> macrhs(finest_level + 1);
     Vector<MultiFab> macphi(finest_level + 1);
     Vector<MultiFab> S_cc_nph(finest_level + 1);
-    Vector<MultiFab> rho_omegadot(finest_level + 1);
     Vector<MultiFab> thermal1(finest_level + 1);
     Vector<MultiFab> thermal2(finest_level + 1);
-    Vector<MultiFab> rho_Hnuc(finest_level + 1);
     Vector<MultiFab> rho_Hext(finest_level + 1);
     Vector<MultiFab> s1(finest_level + 1);
     Vector<MultiFab> s2(finest_level + 1);
     Vector<MultiFab> s2star(finest_level + 1);
     Vector<MultiFab> delta_gamma1_term(finest_level + 1);
     Vector<MultiFab> delta_gamma1(finest_level + 1);
-    Vector<MultiFab> p0_cart(finest_level + 1);
     Vector<MultiFab> delta_p_term(finest_level + 1);
     Vector<MultiFab> Tcoeff(finest_level + 1);
     Vector<MultiFab> hcoeff1(finest_level + 1);
@@ -81,6 +78,10 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // end spherical-only MultiFabs
     ////////////////////////
 
+    // the MultiFabs above are drawn from scratch_pool and handed back
+    // when we leave this routine
+    MultiFabPool::Lease scratch(scratch_pool);
+
     // vectors store the multilevel 1D states as one very long array
     // these are cell-centered
     BaseState<Real> grav_cell_nph(base_geom.max_radial_level + 1,
@@ -124,66 +125,70 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         // cell-centered MultiFabs
-        rhohalf[lev].define(grids[lev], dmap[lev], 1, 1);
-        macrhs[lev].define(grids[lev], dmap[lev], 1, 0);
-        macphi[lev].define(grids[lev], dmap[lev], 1, 1);
-        S_cc_nph[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_omegadot[lev].define(grids[lev], dmap[lev], NumSpec, 0);
-        thermal1[lev].define(grids[lev], dmap[lev], 1, 0);
-        thermal2[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_Hnuc[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_Hext[lev].define(grids[lev], dmap[lev], 1, 0);
-        s1[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
+        scratch.define(rhohalf[lev], grids[lev], dmap[lev], 1, 1);
+        scratch.define(macrhs[lev], grids[lev], dmap[lev], 1, 0);
+        scratch.define(macphi[lev], grids[lev], dmap[lev], 1, 1);
+        scratch.define(S_cc_nph[lev], grids[lev], dmap[lev], 1, 0);
+        scratch.define(thermal1[lev], grids[lev], dmap[lev], 1, 0);
+        scratch.define(thermal2[lev], grids[lev], dmap[lev], 1, 0);
+        scratch.define(rho_Hext[lev], grids[lev], dmap[lev], 1, 0);
+        scratch.define(s1[lev], grids[lev], dmap[lev], Nscal, ng_s);
         s1[lev].setVal(0.);
-        s2[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
-        s2star[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
-        delta_gamma1_term[lev].define(grids[lev], dmap[lev], 1, 0);
-        delta_gamma1[lev].define(grids[lev], dmap[lev], 1, 0);
-        delta_p_term[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        Tcoeff[lev].define(grids[lev], dmap[lev], 1, 1);
-        hcoeff1[lev].define(grids[lev], dmap[lev], 1, 1);
-        Xkcoeff1[lev].define(grids[lev], dmap[lev], NumSpec, 1);
-        pcoeff1[lev].define(grids[lev], dmap[lev], 1, 1);
-        hcoeff2[lev].define(grids[lev], dmap[lev], 1, 1);
-        Xkcoeff2[lev].define(grids[lev], dmap[lev], NumSpec, 1);
-        pcoeff2[lev].define(grids[lev], dmap[lev], 1, 1);
+        scratch.define(s2[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        scratch.define(s2star[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        scratch.define(delta_gamma1_term[lev], grids[lev], dmap[lev], 1, 0);
+        scratch.define(delta_gamma1[lev], grids[lev], dmap[lev], 1, 0);
+        scratch.define(delta_p_term[lev], grids[lev], dmap[lev], 1, 0);
+        scratch.define(Tcoeff[lev], grids[lev], dmap[lev], 1, 1);
+        scratch.define(hcoeff1[lev], grids[lev], dmap[lev], 1, 1);
+        scratch.define(Xkcoeff1[lev], grids[lev], dmap[lev], NumSpec, 1);
+        scratch.define(pcoeff1[lev], grids[lev], dmap[lev], 1, 1);
+        scratch.define(hcoeff2[lev], grids[lev], dmap[lev], 1, 1);
+        scratch.define(Xkcoeff2[lev], grids[lev], dmap[lev], NumSpec, 1);
+        scratch.define(pcoeff2[lev], grids[lev], dmap[lev], 1, 1);
         if (ppm_trace_forces == 0) {
-            scal_force[lev].define(grids[lev], dmap[lev], Nscal, 1);
+            scratch.define(scal_force[lev], grids[lev], dmap[lev], Nscal, 1);
         } else {
             // we need more ghostcells if we are tracing the forces
-            scal_force[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
+            scratch.define(scal_force[lev], grids[lev], dmap[lev], Nscal, ng_s);
         }
-        delta_chi[lev].define(grids[lev], dmap[lev], 1, 0);
-        sponge[lev].define(grids[lev], dmap[lev], 1, 0);
+        scratch.define(delta_chi[lev], grids[lev], dmap[lev], 1, 0);
+        scratch.define(sponge[lev], grids[lev], dmap[lev], 1, 0);
 
         // face-centered in the dm-direction (planar only)
-        AMREX_D_TERM(etarhoflux[lev].define(convert(grids[lev], nodal_flag_x),
-                                            dmap[lev], 1, 1);
-                     , etarhoflux[lev].define(convert(grids[lev], nodal_flag_y),
-                                              dmap[lev], 1, 1);
-                     , etarhoflux[lev].define(convert(grids[lev], nodal_flag_z),
-                                              dmap[lev], 1, 1););
+        scratch.define(etarhoflux[lev],
+                       convert(grids[lev],
+                               IntVect::TheDimensionVector(AMREX_SPACEDIM - 1)),
+                       dmap[lev], 1, 1);
 
         // face-centered arrays of MultiFabs
-        AMREX_D_TERM(umac[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                         dmap[lev], 1, 1);
-                     , umac[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                           dmap[lev], 1, 1);
-                     , umac[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                           dmap[lev], 1, 1););
-        AMREX_D_TERM(sedge[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                          dmap[lev], Nscal, 0);
-                     , sedge[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                            dmap[lev], Nscal, 0);
-                     , sedge[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                            dmap[lev], Nscal, 0););
-        AMREX_D_TERM(sflux[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                          dmap[lev], Nscal, 0);
-                     , sflux[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                            dmap[lev], Nscal, 0);
-                     , sflux[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                            dmap[lev], Nscal, 0););
+        AMREX_D_TERM(scratch.define(umac[lev][0],
+                                    convert(grids[lev], nodal_flag_x),
+                                    dmap[lev], 1, 1);
+                     , scratch.define(umac[lev][1],
+                                      convert(grids[lev], nodal_flag_y),
+                                      dmap[lev], 1, 1);
+                     , scratch.define(umac[lev][2],
+                                      convert(grids[lev], nodal_flag_z),
+                                      dmap[lev], 1, 1););
+        AMREX_D_TERM(scratch.define(sedge[lev][0],
+                                    convert(grids[lev], nodal_flag_x),
+                                    dmap[lev], Nscal, 0);
+                     , scratch.define(sedge[lev][1],
+                                      convert(grids[lev], nodal_flag_y),
+                                      dmap[lev], Nscal, 0);
+                     , scratch.define(sedge[lev][2],
+                                      convert(grids[lev], nodal_flag_z),
+                                      dmap[lev], Nscal, 0););
+        AMREX_D_TERM(scratch.define(sflux[lev][0],
+                                    convert(grids[lev], nodal_flag_x),
+                                    dmap[lev], Nscal, 0);
+                     , scratch.define(sflux[lev][1],
+                                      convert(grids[lev], nodal_flag_y),
+                                      dmap[lev], Nscal, 0);
+                     , scratch.define(sflux[lev][2],
+                                      convert(grids[lev], nodal_flag_z),
+                                      dmap[lev], Nscal, 0););
 
         // initialize umac
         for (int d = 0; d < AMREX_SPACEDIM; ++d) {
@@ -192,17 +197,18 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
             sflux[lev][d].setVal(0.);
         }
 
-        w0_force_cart[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
+        scratch.define(w0_force_cart[lev], grids[lev], dmap[lev],
+                       AMREX_SPACEDIM, 1);
     }
 
 #if (AMREX_SPACEDIM == 3)
     for (int lev = 0; lev <= finest_level; ++lev) {
-        w0mac[lev][0].define(convert(grids[lev], nodal_flag_x), dmap[lev], 1,
-                             1);
-        w0mac[lev][1].define(convert(grids[lev], nodal_flag_y), dmap[lev], 1,
-                             1);
-        w0mac[lev][2].define(convert(grids[lev], nodal_flag_z), dmap[lev], 1,
-                             1);
+        scratch.define(w0mac[lev][0], convert(grids[lev], nodal_flag_x),
+                       dmap[lev], 1, 1);
+        scratch.define(w0mac[lev][1], convert(grids[lev], nodal_flag_y),
+                       dmap[lev], 1, 1);
+        scratch.define(w0mac[lev][2], convert(grids[lev], nodal_flag_z),
+                       dmap[lev], 1, 1);
     }
 #endif
 
@@ -234,6 +240,10 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
 
     React(sold, s1, rho_Hext, rho_omegadot, rho_Hnuc, p0_old, 0.5 * dt, t_old);
 
+    // rho_omegadot and rho_Hnuc are refilled by every burn of the step, and
+    // the diagnostics and plotfiles reuse the rates of the last one
+    have_reaction_rates = true;
+
     react_time += ParallelDescriptor::second() - react_time_start;
     ParallelDescriptor::ReduceRealMax(react_time,
                                       ParallelDescriptor::IOProcessorNumber());
@@ -273,19 +283,19 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
         // peos_old (delta_p_term) now holds the thermodynamic p computed from sold(rho,h,X)
         PfromRhoH(sold, sold, delta_p_term);
 
-        // compute peosbar = Avg(peos_old)
-        Average(delta_p_term, peosbar, 0);
+        // compute peosbar = Avg(peos_old), together with Sbar =
+        // Avg(S_cc_nph) if that is needed below
+        if (evolve_base_state) {
+            Average({{delta_p_term, 0, peosbar}, {S_cc_nph, 0, Sbar}});
+        } else {
+            Average(delta_p_term, peosbar, 0);
+        }
 
         // compute p0_minus_peosbar = p0_old - peosbar
         p0_minus_peosbar.copy(p0_old - peosbar);
 
-        // put p0_old on cart
-        Put1dArrayOnCart(p0_old, p0_cart, false, false, bcs_f, 0);
-
         // compute delta_p_term = peos_old - p0_old
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            MultiFab::Subtract(delta_p_term[lev], p0_cart[lev], 0, 0, 1, 0);
-        }
+        Combine1dArrayWithCart(p0_old, delta_p_term, 0, BaseStateOp::Subtract);
     } else {
         // these should have no effect if dpdt_factor <= 0
         p0_minus_peosbar.setVal(0.0);
@@ -307,8 +317,11 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     }
 
     if (evolve_base_state) {
-        // compute Sbar = average(S_cc_nph)
-        Average(S_cc_nph, Sbar, 0);
+        // compute Sbar = average(S_cc_nph), unless it was averaged
+        // with peosbar
+        if (dpdt_factor <= 0.) {
+            Average(S_cc_nph, Sbar, 0);
+        }
 
         // save old-time value
         w0_old.copy(w0);
@@ -696,19 +709,19 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
         // peos now holds "peos_new", the thermodynamic p computed from snew(rho,h,X)
         PfromRhoH(snew, snew, delta_p_term);
 
-        // compute peosbar = Avg(peos_new)
-        Average(delta_p_term, peosbar, 0);
+        // compute peosbar = Avg(peos_new), together with Sbar =
+        // Avg(S_cc_nph) if that is needed below
+        if (evolve_base_state) {
+            Average({{delta_p_term, 0, peosbar}, {S_cc_nph, 0, Sbar}});
+        } else {
+            Average(delta_p_term, peosbar, 0);
+        }
 
         // compute p0_minus_peosbar = p0_new - peosbar
         p0_minus_peosbar.copy(p0_new - peosbar);
 
-        // put p0_new on cart
-        Put1dArrayOnCart(p0_new, p0_cart, false, false, bcs_f, 0);
-
         // set delta_p_term = peos_new - p0_new
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            MultiFab::Subtract(delta_p_term[lev], p0_cart[lev], 0, 0, 1, 0);
-        }
+        Combine1dArrayWithCart(p0_new, delta_p_term, 0, BaseStateOp::Subtract);
     } else {
         // these should have no effect if dpdt_factor <= 0
         p0_minus_peosbar.setVal(0.);
@@ -718,8 +731,11 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     }
 
     if (evolve_base_state) {
-        // compute Sbar = average(S_cc_nph)
-        Average(S_cc_nph, Sbar, 0);
+        // compute Sbar = average(S_cc_nph), unless it was averaged
+        // with peosbar
+        if (dpdt_factor <= 0.) {
+            Average(S_cc_nph, Sbar, 0);
+        }
 
         // compute Sbar = Sbar + delta_gamma1_termbar
         if (use_delta_gamma1_term) {
@@ -1144,13 +1160,9 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
             // peos now holds "peos_new", the thermodynamic p computed from snew(rho,h,X)
             PfromRhoH(snew, snew, delta_p_term);
 
-            // put p0_new on cart
-            Put1dArrayOnCart(p0_new, p0_cart, false, false, bcs_f, 0);
-
             // compute delta_p_term = peos_new - p0_new
-            for (int lev = 0; lev <= finest_level; ++lev) {
-                MultiFab::Subtract(delta_p_term[lev], p0_cart[lev], 0, 0, 1, 0);
-            }
+            Combine1dArrayWithCart(p0_new, delta_p_term, 0,
+                                   BaseStateOp::Subtract);
 
             CorrectRHCCforNodalProj(rhcc_for_nodalproj, rho0_new, beta0_nph,
                                     gamma1bar_new, p0_new, delta_p_term);
@@ -1198,5 +1210,7 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
         Print() << "Reactions  :" << react_time << " seconds\n";
         Print() << "Misc       :" << misc_time << " seconds\n";
         Print() << "Base State :" << base_time << " seconds\n";
+        PrintSolverTimes();
+        scratch_pool.PrintStats();
     }
 }
@@ -4,26 +4,102 @@
 
 using namespace amrex;
 
+// the tiles of every field being averaged, for use on the device
+using FieldArrays = GpuArray<Array4<const Real>, MAESTRO_MAX_AVERAGE_FIELDS>;
+
 // Given a multifab of data (phi), average down to a base state quantity, phibar.
 // If we are in plane-parallel, the averaging is at constant height.
 // If we are spherical, { the averaging is done at constant radius.
 
+void Maestro::AverageTilesPlanar(const Vector<AverageField>& fields,
+                                 BaseState<Real>& phisum, const int lev) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::AverageTilesPlanar()", AverageTilesPlanar);
+
+    constexpr int rdir = AMREX_SPACEDIM - 1;
+    const int nfield = fields.size();
+    const MultiFab& phi = fields[0].phi[lev];
+
+    // each tile sums its cells into its own rows of rowsum, starting at
+    // tile_offset.  The tiles are then added into phisum one after the other
+    // in tile order, so the result does not depend on how the tiles were
+    // shared out among the threads, and no atomics are needed.
+    Vector<int> tile_rlo;
+    Vector<int> tile_offset(1, 0);
+    for (MFIter mfi(phi, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        const Box& tilebox = mfi.tilebox();
+        tile_rlo.push_back(tilebox.smallEnd(rdir));
+        tile_offset.push_back(tile_offset.back() +
+                              nfield * tilebox.length(rdir));
+    }
+
+    Vector<Real> rowsum(tile_offset.back(), 0.0);
+    Real* AMREX_RESTRICT rowsum_p = rowsum.dataPtr();
+
+    // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(phi, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        // Get the index space of the valid region
+        const Box& tilebox = mfi.tilebox();
+        const int t = mfi.LocalTileIndex();
+
+        Real* AMREX_RESTRICT tile_rowsum = rowsum_p + tile_offset[t];
+        const int rlo = tile_rlo[t];
+
+        for (int n = 0; n < nfield; ++n) {
+            const Array4<const Real> phi_arr =
+                fields[n].phi[lev].array(mfi, fields[n].comp);
+
+            amrex::LoopOnCpu(tilebox, [=](int i, int j, int k) noexcept {
+                const int r = AMREX_SPACEDIM == 2 ? j : k;
+                tile_rowsum[(r - rlo) * nfield + n] += phi_arr(i, j, k);
+            });
+        }
+    }
+
+    auto phisum_arr = phisum.array();
+    const int ntiles = tile_rlo.size();
+
+    for (int t = 0; t < ntiles; ++t) {
+        for (int m = tile_offset[t]; m < tile_offset[t + 1]; ++m) {
+            const int r = tile_rlo[t] + (m - tile_offset[t]) / nfield;
+            phisum_arr(lev, r, (m - tile_offset[t]) % nfield) += rowsum[m];
+        }
+    }
+}
+
 void Maestro::Average(const Vector<MultiFab>& phi, BaseState<Real>& phibar,
                       int comp) {
+    Average({{phi, comp, phibar}});
+}
+
+void Maestro::Average(const Vector<AverageField>& fields) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::Average()", Average);
 
+    const int nfield = fields.size();
+    if (nfield == 0) {
+        return;
+    } else if (nfield > MAESTRO_MAX_AVERAGE_FIELDS) {
+        Abort("Average: too many fields, increase MAESTRO_MAX_AVERAGE_FIELDS");
+    }
+
     const auto nr_irreg = base_geom.nr_irreg;
 
-    phibar.setVal(0.0);
+    for (const auto& f : fields) {
+        f.phibar.setVal(0.0);
+    }
 
     if (!spherical) {
         // planar case
 
         // phibar is dimensioned to "max_radial_level" so we must mimic that for phisum
-        // so we can simply swap this result with phibar
+        // so we can simply swap this result with phibar.  Component n of
+        // phisum holds the sum of field n, so one reduction covers them all.
         BaseState<Real> phisum(base_geom.max_radial_level + 1,
-                               base_geom.nr_fine);
+                               base_geom.nr_fine, nfield);
         phisum.setVal(0.0);
         auto phisum_arr = phisum.array();
 
@@ -44,46 +120,56 @@ void Maestro::Average(const Vector<MultiFab>& phi, BaseState<Real>& phibar,
                     (domainBox.bigEnd(0) + 1) * (domainBox.bigEnd(1) + 1);
             }
 
-            // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
-#ifdef _OPENMP
-#pragma omp parallel if (!system::regtest_reduction)
+#ifdef AMREX_USE_CUDA
+            // Atomic::Add is non-deterministic on the GPU. If this flag is true,
+            // run on the CPU instead
+            bool launched;
+            if (deterministic_nodal_solve) {
+                launched = !Gpu::notInLaunchRegion();
+                // turn off GPU
+                if (launched) Gpu::setLaunchRegion(false);
+            }
 #endif
-            for (MFIter mfi(phi[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-                // Get the index space of the valid region
-                const Box& tilebox = mfi.tilebox();
 
-                const Array4<const Real> phi_arr = phi[lev].array(mfi, comp);
+            if (Gpu::inLaunchRegion()) {
+                // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+                for (MFIter mfi(fields[0].phi[lev], TilingIfNotGPU());
+                     mfi.isValid(); ++mfi) {
+                    // Get the index space of the valid region
+                    const Box& tilebox = mfi.tilebox();
+
+                    FieldArrays phi_arr;
+                    for (int n = 0; n < nfield; ++n) {
+                        phi_arr[n] =
+                            fields[n].phi[lev].array(mfi, fields[n].comp);
+                    }
 
-#ifdef AMREX_USE_CUDA
-                // Atomic::Add is non-deterministic on the GPU. If this flag is true,
-                // run on the CPU instead
-                bool launched;
-                if (deterministic_nodal_solve) {
-                    launched = !Gpu::notInLaunchRegion();
-                    // turn off GPU
-                    if (launched) Gpu::setLaunchRegion(false);
+                    ParallelFor(tilebox,
+                                [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                                    int r = AMREX_SPACEDIM == 2 ? j : k;
+                                    for (int n = 0; n < nfield; ++n) {
+                                        amrex::HostDevice::Atomic::Add(
+                                            &(phisum_arr(lev, r, n)),
+                                            phi_arr[n](i, j, k));
+                                    }
+                                });
                 }
-#endif
-
-                ParallelFor(tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                    int r = AMREX_SPACEDIM == 2 ? j : k;
-                    amrex::HostDevice::Atomic::Add(&(phisum_arr(lev, r)),
-                                                   phi_arr(i, j, k));
-                });
+            } else {
+                AverageTilesPlanar(fields, phisum, lev);
+            }
 
 #ifdef AMREX_USE_CUDA
-                if (deterministic_nodal_solve) {
-                    // turn GPU back on
-                    if (launched) Gpu::setLaunchRegion(true);
-                }
-#endif
+            if (deterministic_nodal_solve) {
+                // turn GPU back on
+                if (launched) Gpu::setLaunchRegion(true);
             }
+#endif
         }
 
         // reduction over boxes to get sum
         ParallelDescriptor::ReduceRealSum(
             phisum.dataPtr(),
-            (base_geom.max_radial_level + 1) * base_geom.nr_fine);
+            (base_geom.max_radial_level + 1) * base_geom.nr_fine * nfield);
 
         // divide phisum by ncell so it stores "phibar"
         for (int lev = 0; lev <= finest_level; ++lev) {
@@ -92,97 +178,119 @@ void Maestro::Average(const Vector<MultiFab>& phi, BaseState<Real>& phibar,
                 const int hi = base_geom.r_end_coord(lev, i);
                 ParallelFor(hi - lo + 1, [=] AMREX_GPU_DEVICE(int j) {
                     int r = j + lo;
-                    phisum_arr(lev, r) /= ncell(lev);
+                    for (int n = 0; n < nfield; ++n) {
+                        phisum_arr(lev, r, n) /= ncell(lev);
+                    }
                 });
                 Gpu::synchronize();
             }
         }
 
-        RestrictBase(phisum, true);
-        FillGhostBase(phisum, true);
+        for (int n = 0; n < nfield; ++n) {
+            BaseState<Real> phibar_n(base_geom.max_radial_level + 1,
+                                     base_geom.nr_fine);
+            auto phibar_arr = phibar_n.array();
+            for (int lev = 0; lev <= base_geom.max_radial_level; ++lev) {
+                for (int r = 0; r < base_geom.nr_fine; ++r) {
+                    phibar_arr(lev, r) = phisum_arr(lev, r, n);
+                }
+            }
 
-        // swap pointers so phibar contains the computed average
-        phisum.swap(phibar);
+            RestrictBase(phibar_n, true);
+            FillGhostBase(phibar_n, true);
+
+            // swap pointers so phibar contains the computed average
+            phibar_n.swap(fields[n].phibar);
+        }
 
     } else if (spherical && use_exact_base_state) {
         // spherical case with uneven base state spacing
 
         // phibar is dimensioned to "max_radial_level" so we must mimic that for phisum
-        // so we can simply swap this result with phibar
+        // so we can simply swap this result with phibar.  Component n of
+        // phisum holds the sum of field n and the last component counts the
+        // cells in each bin, so one reduction covers them all.
         BaseState<Real> phisum(base_geom.max_radial_level + 1,
-                               base_geom.nr_fine);
+                               base_geom.nr_fine, nfield + 1);
         phisum.setVal(0.0);
         auto phisum_arr = phisum.array();
 
-        // this stores how many cells there are at each level
-        BaseState<int> ncell_s(base_geom.max_radial_level + 1,
-                               base_geom.nr_fine);
-        auto ncell = ncell_s.array();
-
         // loop is over the existing levels (up to finest_level)
         for (int lev = 0; lev <= finest_level; ++lev) {
 // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel if (!system::regtest_reduction)
 #endif
-            for (MFIter mfi(phi[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            for (MFIter mfi(fields[0].phi[lev], TilingIfNotGPU());
+                 mfi.isValid(); ++mfi) {
                 // Get the index space of the valid region
                 const Box& tilebox = mfi.tilebox();
 
                 const Array4<const int> cc_to_r = cell_cc_to_r[lev].array(mfi);
-                const Array4<const Real> phi_arr = phi[lev].array(mfi, comp);
+
+                FieldArrays phi_arr;
+                for (int n = 0; n < nfield; ++n) {
+                    phi_arr[n] = fields[n].phi[lev].array(mfi, fields[n].comp);
+                }
 
                 ParallelFor(tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
                     auto index = cc_to_r(i, j, k);
 
-                    amrex::HostDevice::Atomic::Add(&(phisum_arr(lev, index)),
-                                                   phi_arr(i, j, k));
-                    amrex::HostDevice::Atomic::Add(&(ncell(lev, index)), 1);
+                    for (int n = 0; n < nfield; ++n) {
+                        amrex::HostDevice::Atomic::Add(
+                            &(phisum_arr(lev, index, n)), phi_arr[n](i, j, k));
+                    }
+                    amrex::HostDevice::Atomic::Add(
+                        &(phisum_arr(lev, index, nfield)), 1.0);
                 });
             }
         }
 
         // reduction over boxes to get sum
-        ParallelDescriptor::ReduceRealSum(
-            phisum.dataPtr(),
-            (base_geom.max_radial_level + 1) * base_geom.nr_fine);
-        ParallelDescriptor::ReduceIntSum(
-            ncell.dataPtr(),
-            (base_geom.max_radial_level + 1) * base_geom.nr_fine);
-
-        // divide phisum by ncell so it stores "phibar"
-        for (int lev = 0; lev <= base_geom.max_radial_level; ++lev) {
-            for (int r = 0; r < base_geom.nr_fine; ++r) {
-                if (ncell(lev, r) > 0) {
-                    phisum_arr(lev, r) /= Real(ncell(lev, r));
-                } else {
-                    // keep value constant if it is outside the cutoff coords
-                    phisum_arr(lev, r) = phisum_arr(lev, r - 1);
+        ParallelDescriptor::ReduceRealSum(phisum.dataPtr(),
+                                          (base_geom.max_radial_level + 1) *
+                                              base_geom.nr_fine * (nfield + 1));
+
+        for (int n = 0; n < nfield; ++n) {
+            BaseState<Real> phibar_n(base_geom.max_radial_level + 1,
+                                     base_geom.nr_fine);
+            auto phibar_arr = phibar_n.array();
+
+            // divide phisum by ncell so it stores "phibar"
+            for (int lev = 0; lev <= base_geom.max_radial_level; ++lev) {
+                for (int r = 0; r < base_geom.nr_fine; ++r) {
+                    const Real ncell = phisum_arr(lev, r, nfield);
+                    if (ncell > 0.0) {
+                        phibar_arr(lev, r) = phisum_arr(lev, r, n) / ncell;
+                    } else {
+                        // keep value constant if it is outside the cutoff
+                        // coords
+                        phibar_arr(lev, r) = phibar_arr(lev, r - 1);
+                    }
                 }
             }
-        }
 
-        RestrictBase(phisum, true);
-        FillGhostBase(phisum, true);
+            RestrictBase(phibar_n, true);
+            FillGhostBase(phibar_n, true);
 
-        // swap pointers so phibar contains the computed average
-        phisum.swap(phibar);
+            // swap pointers so phibar contains the computed average
+            phibar_n.swap(fields[n].phibar);
+        }
     } else {
         // spherical case with even base state spacing
 
         // For spherical, we construct a 1D array at each level, phisum, that has space
         // allocated for every possible radius that a cell-center at each level can
         // map into.  The radial locations have been precomputed and stored in radii.
-        BaseState<Real> phisum_s(finest_level + 1, nr_irreg + 2);
+        // Component n of phisum holds field n and the last component counts
+        // the cells at each radius, so one reduction covers them all.
+        BaseState<Real> phisum_s(finest_level + 1, nr_irreg + 2, nfield + 1);
         auto phisum = phisum_s.array();
         phisum_s.setVal(0.0);
         BaseState<Real> radii_s(finest_level + 1, nr_irreg + 3);
         auto radii = radii_s.array();
         BaseState<int> ncell_s(finest_level + 1, nr_irreg + 2);
         auto ncell = ncell_s.array();
-        ncell_s.setVal(0);
-
-        const auto& center_p = center;
 
         const int fine_lev = finest_level + 1;
 
@@ -203,21 +311,13 @@ void Maestro::Average(const Vector<MultiFab>& phi, BaseState<Real>& phibar,
 
         // loop is over the existing levels (up to finest_level)
         for (int lev = finest_level; lev >= 0; --lev) {
-            // Get the grid size of the domain
-            const auto dx = geom[lev].CellSizeArray();
-            const auto prob_lo = geom[lev].ProbLoArray();
-
             // get references to the MultiFabs at level lev
-            const MultiFab& phi_mf = phi[lev];
+            const MultiFab& phi_mf = fields[0].phi[lev];
 
-            // create mask assuming refinement ratio = 2
-            int finelev = lev + 1;
-            if (lev == finest_level) {
-                finelev = finest_level;
-            }
-
-            const BoxArray& fba = phi[finelev].boxArray();
-            const iMultiFab& mask = makeFineMask(phi_mf, fba, IntVect(2));
+            // the radii index of every cell, with the cells covered by
+            // finer cells marked with -1
+            iMultiFab bins_tmp;
+            const iMultiFab& bins = RadialBins(lev, phi_mf, bins_tmp);
 
             // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -227,10 +327,12 @@ void Maestro::Average(const Vector<MultiFab>& phi, BaseState<Real>& phibar,
                 // Get the index space of the valid region
                 const Box& tilebox = mfi.tilebox();
 
-                const Array4<const int> mask_arr = mask.array(mfi);
-                const Array4<const Real> phi_arr = phi[lev].array(mfi, comp);
+                const Array4<const int> bin = bins.array(mfi);
 
-                bool use_mask = !(lev == fine_lev - 1);
+                FieldArrays phi_arr;
+                for (int n = 0; n < nfield; ++n) {
+                    phi_arr[n] = fields[n].phi[lev].array(mfi, fields[n].comp);
+                }
 
 #ifdef AMREX_USE_CUDA
                 // Atomic::Add is non-deterministic on the GPU. If this flag is true,
@@ -244,38 +346,17 @@ void Maestro::Average(const Vector<MultiFab>& phi, BaseState<Real>& phibar,
 #endif
 
                 ParallelFor(tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                    Real x = prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                    Real y = prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                    Real z = prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
+                    const int index = bin(i, j, k);
 
                     // make sure the cell isn't covered by finer cells
-                    bool cell_valid = true;
-                    if (use_mask) {
-                        if (mask_arr(i, j, k) == 1) cell_valid = false;
-                    }
-
-                    if (cell_valid) {
-                        // compute distance to center
-                        Real radius = sqrt(x * x + y * y + z * z);
-
-                        // figure out which radii index this point maps into
-                        auto index = (int)amrex::Math::round(
-                            ((radius / dx[0]) * (radius / dx[0]) - 0.75) / 2.0);
-
-                        // due to roundoff error, need to ensure that we are in the proper radial bin
-                        if (index < nr_irreg) {
-                            if (amrex::Math::abs(radius -
-                                                 radii(lev, index + 1)) >
-                                amrex::Math::abs(radius -
-                                                 radii(lev, index + 2))) {
-                                index++;
-                            }
+                    if (index >= 0) {
+                        for (int n = 0; n < nfield; ++n) {
+                            amrex::HostDevice::Atomic::Add(
+                                &(phisum(lev, index + 1, n)),
+                                phi_arr[n](i, j, k));
                         }
-
                         amrex::HostDevice::Atomic::Add(
-                            &(phisum(lev, index + 1)), phi_arr(i, j, k));
-                        amrex::HostDevice::Atomic::Add(&(ncell(lev, index + 1)),
-                                                       1);
+                            &(phisum(lev, index + 1, nfield)), 1.0);
                     }
                 });
 
@@ -289,19 +370,27 @@ void Maestro::Average(const Vector<MultiFab>& phi, BaseState<Real>& phibar,
         }
 
         // reduction over boxes to get sum
-        ParallelDescriptor::ReduceRealSum(phisum.dataPtr(),
-                                          (finest_level + 1) * (nr_irreg + 2));
-        ParallelDescriptor::ReduceIntSum(ncell.dataPtr(),
-                                         (finest_level + 1) * (nr_irreg + 2));
+        ParallelDescriptor::ReduceRealSum(
+            phisum_s.dataPtr(),
+            (finest_level + 1) * (nr_irreg + 2) * (nfield + 1));
+
+        for (auto n = 0; n <= finest_level; ++n) {
+            for (auto r = 0; r <= nr_irreg + 1; ++r) {
+                ncell(n, r) = int(phisum(n, r, nfield));
+            }
+        }
 
         // normalize phisum so it actually stores the average at a radius
         for (auto n = 0; n <= finest_level; ++n) {
             for (auto r = 0; r <= nr_irreg; ++r) {
-                if (ncell(n, r + 1) > 0) {
-                    phisum(n, r + 1) /= Real(ncell(n, r + 1));
-                } else {
-                    // keep value constant if it is outside the cutoff coords
-                    phisum(n, r + 1) = phisum(n, r);
+                for (int f = 0; f < nfield; ++f) {
+                    if (ncell(n, r + 1) > 0) {
+                        phisum(n, r + 1, f) /= Real(ncell(n, r + 1));
+                    } else {
+                        // keep value constant if it is outside the cutoff
+                        // coords
+                        phisum(n, r + 1, f) = phisum(n, r, f);
+                    }
                 }
             }
         }
@@ -312,8 +401,11 @@ void Maestro::Average(const Vector<MultiFab>& phi, BaseState<Real>& phibar,
         auto max_rcoord = max_rcoord_s.array();
 
         // compute center point for the finest level
-        phisum(finest_level, 0) = (11.0 / 8.0) * phisum(finest_level, 1) -
-                                  (3.0 / 8.0) * phisum(finest_level, 2);
+        for (int f = 0; f < nfield; ++f) {
+            phisum(finest_level, 0, f) =
+                (11.0 / 8.0) * phisum(finest_level, 1, f) -
+                (3.0 / 8.0) * phisum(finest_level, 2, f);
+        }
         ncell(finest_level, 0) = 1;
 
         // choose which level to interpolate from
@@ -399,7 +491,9 @@ void Maestro::Average(const Vector<MultiFab>& phi, BaseState<Real>& phibar,
                 }
                 if (j > nr_irreg) {
                     for (auto i = r; i <= nr_irreg; ++i) {
-                        phisum(n, i + 1) = 1.e99;
+                        for (int f = 0; f < nfield; ++f) {
+                            phisum(n, i + 1, f) = 1.e99;
+                        }
                     }
                     for (auto i = r; i <= nr_irreg + 1; ++i) {
                         radii(n, i + 1) = 1.e99;
@@ -407,7 +501,9 @@ void Maestro::Average(const Vector<MultiFab>& phi, BaseState<Real>& phibar,
                     max_rcoord(n) = r - 1;
                     break;
                 }
-                phisum(n, r + 1) = phisum(n, j + 1);
+                for (int f = 0; f < nfield; ++f) {
+                    phisum(n, r + 1, f) = phisum(n, j + 1, f);
+                }
                 radii(n, r + 1) = radii(n, j + 1);
                 ncell(n, r + 1) = ncell(n, j + 1);
                 j++;
@@ -420,7 +516,10 @@ void Maestro::Average(const Vector<MultiFab>& phi, BaseState<Real>& phibar,
 
         // compute phibar
         const Real drdxfac_loc = drdxfac;
-        auto phibar_arr = phibar.array();
+        GpuArray<BaseStateArray<Real>, MAESTRO_MAX_AVERAGE_FIELDS> phibar_arr;
+        for (int f = 0; f < nfield; ++f) {
+            phibar_arr[f] = fields[f].phibar.array();
+        }
 
         ParallelFor(nrf, [=] AMREX_GPU_DEVICE(int r) {
             Real radius = (Real(r) + 0.5) * dr0;
@@ -445,14 +544,122 @@ void Maestro::Average(const Vector<MultiFab>& phi, BaseState<Real>& phibar,
             bool limit =
                 (r <= nrf - 1 - drdxfac_loc * pow(2.0, (fine_lev - 2)));
 
-            phibar_arr(0, r) =
-                QuadInterp(radius, radii(which_lev(r), stencil_coord),
-                           radii(which_lev(r), stencil_coord + 1),
-                           radii(which_lev(r), stencil_coord + 2),
-                           phisum(which_lev(r), stencil_coord),
-                           phisum(which_lev(r), stencil_coord + 1),
-                           phisum(which_lev(r), stencil_coord + 2), limit);
+            // the stencil is the same for every field
+            const int wl = which_lev(r);
+            for (int f = 0; f < nfield; ++f) {
+                phibar_arr[f](0, r) = QuadInterp(
+                    radius, radii(wl, stencil_coord),
+                    radii(wl, stencil_coord + 1), radii(wl, stencil_coord + 2),
+                    phisum(wl, stencil_coord, f),
+                    phisum(wl, stencil_coord + 1, f),
+                    phisum(wl, stencil_coord + 2, f), limit);
+            }
         });
         Gpu::synchronize();
     }
 }
+
+void Maestro::MakeRadialBins() {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeRadialBins()", MakeRadialBins);
+
+    for (int lev = 0; lev <= max_level; ++lev) {
+        cell_radial_bin[lev].clear();
+        cell_radial_bin_fine_grids[lev] = BoxArray();
+    }
+
+    // the bins are only used by the even spacing spherical Average
+    if (!spherical || use_exact_base_state) {
+        return;
+    }
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        cell_radial_bin[lev].define(grids[lev], dmap[lev], 1, 0);
+        FillRadialBins(lev, cell_radial_bin[lev]);
+        if (lev < finest_level) {
+            cell_radial_bin_fine_grids[lev] = grids[lev + 1];
+        }
+    }
+}
+
+const iMultiFab& Maestro::RadialBins(const int lev, const FabArrayBase& mf,
+                                     iMultiFab& bins_tmp) {
+    const iMultiFab& bins = cell_radial_bin[lev];
+    const BoxArray fine_grids =
+        lev < finest_level ? grids[lev + 1] : BoxArray();
+
+    // the cache is only good if neither these grids nor the finer grids
+    // masking them have changed since it was built
+    if (bins.ok() && bins.boxArray().CellEqual(mf.boxArray()) &&
+        bins.DistributionMap() == mf.DistributionMap() &&
+        cell_radial_bin_fine_grids[lev] == fine_grids) {
+        return bins;
+    }
+
+    bins_tmp.define(mf.boxArray(), mf.DistributionMap(), 1, 0);
+    FillRadialBins(lev, bins_tmp);
+    return bins_tmp;
+}
+
+void Maestro::FillRadialBins(const int lev, iMultiFab& bins) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::FillRadialBins()", FillRadialBins);
+
+    const auto nr_irreg = base_geom.nr_irreg;
+    const auto dx = geom[lev].CellSizeArray();
+    const auto prob_lo = geom[lev].ProbLoArray();
+    const auto& center_p = center;
+
+    // create mask assuming refinement ratio = 2
+    const bool use_mask = lev < finest_level;
+    iMultiFab mask;
+    if (use_mask) {
+        mask = makeFineMask(bins, grids[lev + 1], IntVect(2));
+    }
+
+    // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(bins, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        // Get the index space of the valid region
+        const Box& tilebox = mfi.tilebox();
+
+        const Array4<int> bin = bins.array(mfi);
+        const Array4<const int> mask_arr =
+            use_mask ? mask.const_array(mfi) : bins.const_array(mfi);
+
+        ParallelFor(tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            // cells covered by finer cells don't go in any bin
+            if (use_mask && mask_arr(i, j, k) == 1) {
+                bin(i, j, k) = -1;
+                return;
+            }
+
+            Real x = prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
+            Real y = prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
+            Real z = prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
+
+            // compute distance to center
+            Real radius = sqrt(x * x + y * y + z * z);
+
+            // figure out which radii index this point maps into
+            auto index = (int)amrex::Math::round(
+                ((radius / dx[0]) * (radius / dx[0]) - 0.75) / 2.0);
+
+            // due to roundoff error, need to ensure that we are in the proper radial bin
+            if (index < nr_irreg) {
+                const Real radius_lo =
+                    std::sqrt(0.75 + 2.0 * Real(index)) * dx[0];
+                const Real radius_hi =
+                    std::sqrt(0.75 + 2.0 * Real(index + 1)) * dx[0];
+                if (amrex::Math::abs(radius - radius_lo) >
+                    amrex::Math::abs(radius - radius_hi)) {
+                    index++;
+                }
+            }
+
+            bin(i, j, k) = index;
+        });
+    }
+}
@@ -1,36 +1,49 @@
 
+#include <AMReX_Scan.H>
 #include <Maestro.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
 
+// the parts of tileBox that Burner burns for region: all of it, the cells
+// within ng_edge of the edge of validBox, or the cells further in
+static BoxList BurnRegionBoxes(const Box& tileBox, const Box& validBox,
+                               const IntVect& ng_edge,
+                               const BurnRegion region) {
+    const Box inner = amrex::grow(validBox, -ng_edge);
+
+    BoxList burn_boxes;
+    if (region == BurnRegion::All ||
+        (region == BurnRegion::Edge && !inner.ok())) {
+        burn_boxes.push_back(tileBox);
+    } else if (region == BurnRegion::Edge) {
+        burn_boxes = amrex::boxDiff(tileBox, inner);
+    } else if (tileBox.intersects(inner)) {
+        burn_boxes.push_back(tileBox & inner);
+    }
+    return burn_boxes;
+}
+
 #ifndef SDC
 void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
                      const Vector<MultiFab>& rho_Hext,
                      Vector<MultiFab>& rho_omegadot, Vector<MultiFab>& rho_Hnuc,
                      const BaseState<Real>& p0, const Real dt_in,
-                     const Real time_in) {
+                     const Real time_in, const int burn_lev,
+                     const BurnRegion region) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::Burner()", Burner);
 
-    // Put tempbar_init on cart
-    Vector<MultiFab> tempbar_init_cart(finest_level + 1);
-
-    if (spherical) {
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            tempbar_init_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-            tempbar_init_cart[lev].setVal(0.);
-        }
+    const auto ispec_threshold = network_spec_index(burner_threshold_species);
 
-        if (drive_initial_convection) {
-            Put1dArrayOnCart(tempbar_init, tempbar_init_cart, false, false,
-                             bcs_f, 0);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        if (burn_lev >= 0 && lev != burn_lev) {
+            continue;
         }
-    }
 
-    const auto ispec_threshold = network_spec_index(burner_threshold_species);
+        // width of the edge of each grid that the ghost cells of s_out read
+        const IntVect ng_edge = s_out[lev].nGrowVect();
 
-    for (int lev = 0; lev <= finest_level; ++lev) {
         // create mask assuming refinement ratio = 2
         int finelev = lev + 1;
         if (lev == finest_level) finelev = finest_level;
@@ -53,15 +66,37 @@ void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
             const Array4<const Real> rho_Hext_arr = rho_Hext[lev].array(mfi);
             const Array4<Real> rho_omegadot_arr = rho_omegadot[lev].array(mfi);
             const Array4<Real> rho_Hnuc_arr = rho_Hnuc[lev].array(mfi);
-            const auto tempbar_init_arr = tempbar_init.const_array();
-
-            // use a dummy value for non-spherical as tempbar_init_cart is not defined
-            const Array4<const Real> tempbar_cart_arr =
-                spherical ? tempbar_init_cart[lev].array(mfi)
-                          : rho_Hext[lev].array(mfi);
+            const BaseStateView tempbar_init_view =
+                MakeBaseStateView(tempbar_init, lev, mfi, false);
             const Array4<const int> mask_arr = mask.array(mfi);
+            const Array4<Real> cost_arr = burn_cost[lev].array(mfi);
+            const Array4<Real> stats_arr =
+                do_burn_stats ? burn_stats[lev].array(mfi) : Array4<Real>{};
+
+            // the parts of the tile in the region to burn
+            const BoxList burn_boxes =
+                BurnRegionBoxes(tileBox, mfi.validbox(), ng_edge, region);
+
+            if (compact_burner) {
+                for (const Box& bx : burn_boxes) {
+                    BurnTileCompacted(bx, s_in_arr, s_out_arr, rho_Hext_arr,
+                                      rho_omegadot_arr, rho_Hnuc_arr, cost_arr,
+                                      stats_arr, tempbar_init_view, mask_arr,
+                                      use_mask, ispec_threshold, dt_in);
+                }
+                continue;
+            }
+
+            const auto burn_cell = [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                // unburned cells cost one unit
+                cost_arr(i, j, k) = 1.0;
+
+                if (do_burn_stats) {
+                    for (int n = 0; n < 4; ++n) {
+                        stats_arr(i, j, k, n) = 0.0;
+                    }
+                }
 
-            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
                 if (use_mask && mask_arr(i, j, k))
                     return;  // cell is covered by finer cells
 
@@ -79,12 +114,7 @@ void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
 
                 Real T_in = 0.0;
                 if (drive_initial_convection) {
-                    if (!spherical) {
-                        auto r = (AMREX_SPACEDIM == 2) ? j : k;
-                        T_in = tempbar_init_arr(lev, r);
-                    } else {
-                        T_in = tempbar_cart_arr(i, j, k);
-                    }
+                    T_in = tempbar_init_view(i, j, k);
                 } else {
                     T_in = s_in_arr(i, j, k, Temp);
                 }
@@ -138,6 +168,15 @@ void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
 
                     burner(state_out, dt_in);
 
+                    cost_arr(i, j, k) += Real(state_out.n_rhs);
+
+                    if (do_burn_stats) {
+                        stats_arr(i, j, k, 0) = Real(state_out.n_step);
+                        stats_arr(i, j, k, 1) = Real(state_out.n_rhs);
+                        stats_arr(i, j, k, 2) = Real(state_out.n_jac);
+                        stats_arr(i, j, k, 3) = state_out.success ? 0.0 : 1.0;
+                    }
+
                     for (int n = 0; n < NumSpec; ++n) {
                         x_out[n] = state_out.xn[n];
                         rhowdot[n] = state_out.rho *
@@ -202,32 +241,256 @@ void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
                 s_out_arr(i, j, k, RhoH) = s_in_arr(i, j, k, RhoH) +
                                            dt_in * rho_Hnuc_arr(i, j, k) +
                                            dt_in * rho_Hext_arr(i, j, k);
-            });
+            };
+
+            for (const Box& bx : burn_boxes) {
+                ParallelFor(bx, burn_cell);
+            }
         }
     }
 }
 
+void Maestro::BurnTileCompacted(
+    const Box& tileBox, const Array4<const Real>& s_in_arr,
+    const Array4<Real>& s_out_arr, const Array4<const Real>& rho_Hext_arr,
+    const Array4<Real>& rho_omegadot_arr, const Array4<Real>& rho_Hnuc_arr,
+    const Array4<Real>& cost_arr, const Array4<Real>& stats_arr,
+    const BaseStateView& tempbar_init_view, const Array4<const int>& mask_arr,
+    const bool use_mask,
+    const int ispec_threshold, const Real dt_in) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::BurnTileCompacted()", BurnTileCompacted);
+
+    const int ncells = tileBox.numPts();
+
+    Gpu::DeviceVector<int> burn_flag(ncells);
+    int* AMREX_RESTRICT flag = burn_flag.data();
+
+    // flag the cells to burn, and give every other (uncovered) cell the
+    // result of not burning: the species and auxiliary variables are passed
+    // through, the rates are zero and only the external heating goes into
+    // rhoh.  The burned cells are overwritten below.
+    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+        const int m = tileBox.index(IntVect(AMREX_D_DECL(i, j, k)));
+        flag[m] = 0;
+
+        // unburned cells cost one unit
+        cost_arr(i, j, k) = 1.0;
+
+        if (do_burn_stats) {
+            for (int n = 0; n < 4; ++n) {
+                stats_arr(i, j, k, n) = 0.0;
+            }
+        }
+
+        if (use_mask && mask_arr(i, j, k)) {
+            return;  // cell is covered by finer cells
+        }
+
+        const Real rho = s_in_arr(i, j, k, Rho);
+
+        const Real x_test =
+            (ispec_threshold > 0)
+                ? s_in_arr(i, j, k, FirstSpec + ispec_threshold) / rho
+                : 0.0;
+
+        // if the threshold species is not in the network, then we burn
+        // normally.  if it is in the network, make sure the mass
+        // fraction is above the cutoff.
+        if ((rho > burning_cutoff_density_lo &&
+             rho < burning_cutoff_density_hi) &&
+            (ispec_threshold < 0 ||
+             (ispec_threshold > 0 && x_test > burner_threshold_cutoff))) {
+            flag[m] = 1;
+        }
+
+        // check if sum{X_k} = 1
+        Real sumX = 0.0;
+        for (int n = 0; n < NumSpec; ++n) {
+            sumX += s_in_arr(i, j, k, FirstSpec + n) / rho;
+        }
+        if (!flag[m] && fabs(sumX - 1.0) > reaction_sum_tol) {
+#ifndef AMREX_USE_GPU
+            Abort("ERROR: abundances do not sum to 1");
+#endif
+        }
+
+        // pass the density and pi through
+        s_out_arr(i, j, k, Rho) = rho;
+        s_out_arr(i, j, k, Pi) = s_in_arr(i, j, k, Pi);
+
+        for (int n = 0; n < NumSpec; ++n) {
+            s_out_arr(i, j, k, FirstSpec + n) =
+                (s_in_arr(i, j, k, FirstSpec + n) / rho) * rho;
+            rho_omegadot_arr(i, j, k, n) = 0.0;
+        }
+#if NAUX_NET > 0
+        for (int n = 0; n < NumAux; ++n) {
+            s_out_arr(i, j, k, FirstAux + n) =
+                (s_in_arr(i, j, k, FirstAux + n) / rho) * rho;
+        }
+#endif
+        rho_Hnuc_arr(i, j, k) = 0.0;
+
+        s_out_arr(i, j, k, RhoH) =
+            s_in_arr(i, j, k, RhoH) + dt_in * rho_Hext_arr(i, j, k);
+    });
+
+    // pack the offsets of the flagged cells into a list
+    Gpu::DeviceVector<int> burn_list(ncells);
+    int* AMREX_RESTRICT cell = burn_list.data();
+
+    const int nburn = Scan::PrefixSum<int>(
+        ncells, [=] AMREX_GPU_DEVICE(int m) -> int { return flag[m]; },
+        [=] AMREX_GPU_DEVICE(int m, int const& ps) {
+            if (flag[m]) {
+                cell[ps] = m;
+            }
+        },
+        Scan::Type::exclusive);
+
+    if (nburn == 0) {
+        return;
+    }
+
+    // gather the cells to burn into structure-of-arrays buffers, so that
+    // component c of the m-th cell is at c*nburn + m
+    constexpr int iX = 2;  // after rho and T
+    constexpr int iaux = iX + NumSpec;
+    constexpr int nbuf = iaux + NumAux;
+
+    Gpu::DeviceVector<Real> burn_in(nbuf * nburn);
+    Gpu::DeviceVector<Real> burn_out(nbuf * nburn);
+    Real* AMREX_RESTRICT state_in = burn_in.data();
+    Real* AMREX_RESTRICT state_out = burn_out.data();
+
+    ParallelFor(nburn, [=] AMREX_GPU_DEVICE(int m) {
+        const auto p = tileBox.atOffset(cell[m]).dim3();
+
+        const Real rho = s_in_arr(p.x, p.y, p.z, Rho);
+        state_in[m] = rho;
+        state_in[nburn + m] = drive_initial_convection
+                                  ? tempbar_init_view(p.x, p.y, p.z)
+                                  : s_in_arr(p.x, p.y, p.z, Temp);
+        for (int n = 0; n < NumSpec; ++n) {
+            state_in[(iX + n) * nburn + m] =
+                s_in_arr(p.x, p.y, p.z, FirstSpec + n) / rho;
+        }
+#if NAUX_NET > 0
+        for (int n = 0; n < NumAux; ++n) {
+            state_in[(iaux + n) * nburn + m] =
+                s_in_arr(p.x, p.y, p.z, FirstAux + n) / rho;
+        }
+#endif
+    });
+
+    // burn only the packed cells; state_out holds the energy release in
+    // place of T
+    ParallelFor(nburn, [=] AMREX_GPU_DEVICE(int m) {
+        burn_t state;
+        state.e = 0.0;
+        state.rho = state_in[m];
+        state.T = state_in[nburn + m];
+        for (int n = 0; n < NumSpec; ++n) {
+            state.xn[n] = state_in[(iX + n) * nburn + m];
+        }
+#if NAUX_NET > 0
+        for (int n = 0; n < NumAux; ++n) {
+            state.aux[n] = state_in[(iaux + n) * nburn + m];
+        }
+#endif
+
+        burner(state, dt_in);
+
+        const auto p = tileBox.atOffset(cell[m]).dim3();
+        cost_arr(p.x, p.y, p.z) += Real(state.n_rhs);
+
+        if (do_burn_stats) {
+            stats_arr(p.x, p.y, p.z, 0) = Real(state.n_step);
+            stats_arr(p.x, p.y, p.z, 1) = Real(state.n_rhs);
+            stats_arr(p.x, p.y, p.z, 2) = Real(state.n_jac);
+            stats_arr(p.x, p.y, p.z, 3) = state.success ? 0.0 : 1.0;
+        }
+
+        state_out[m] = state.rho;
+        state_out[nburn + m] = state.e;
+        for (int n = 0; n < NumSpec; ++n) {
+            state_out[(iX + n) * nburn + m] = state.xn[n];
+        }
+#if NAUX_NET > 0
+        for (int n = 0; n < NumAux; ++n) {
+            state_out[(iaux + n) * nburn + m] = state.aux[n];
+        }
+#endif
+    });
+
+    // scatter the results back to the burned cells
+    ParallelFor(nburn, [=] AMREX_GPU_DEVICE(int m) {
+        const auto p = tileBox.atOffset(cell[m]).dim3();
+
+        const Real rho = state_in[m];
+        const Real rho_out = state_out[m];
+
+        // check if sum{X_k} = 1
+        Real sumX = 0.0;
+        for (int n = 0; n < NumSpec; ++n) {
+            sumX += state_out[(iX + n) * nburn + m];
+        }
+        if (fabs(sumX - 1.0) > reaction_sum_tol) {
+#ifndef AMREX_USE_GPU
+            Abort("ERROR: abundances do not sum to 1");
+#endif
+        }
+
+        // update the species and store the species create quantities
+        for (int n = 0; n < NumSpec; ++n) {
+            const Real x_out = state_out[(iX + n) * nburn + m];
+            s_out_arr(p.x, p.y, p.z, FirstSpec + n) = x_out * rho;
+            rho_omegadot_arr(p.x, p.y, p.z, n) =
+                rho_out * (x_out - state_in[(iX + n) * nburn + m]) / dt_in;
+        }
+
+        // update the auxiliary variables
+#if NAUX_NET > 0
+        for (int n = 0; n < NumAux; ++n) {
+            s_out_arr(p.x, p.y, p.z, FirstAux + n) =
+                state_out[(iaux + n) * nburn + m] * rho;
+        }
+#endif
+
+        // store the energy generation
+        const Real rhoH = rho_out * state_out[nburn + m] / dt_in;
+        rho_Hnuc_arr(p.x, p.y, p.z) = rhoH;
+
+        // update the enthalpy -- include the change due to external heating
+        s_out_arr(p.x, p.y, p.z, RhoH) = s_in_arr(p.x, p.y, p.z, RhoH) +
+                                         dt_in * rhoH +
+                                         dt_in * rho_Hext_arr(p.x, p.y, p.z);
+    });
+
+    // the buffers go out of scope with this tile
+    Gpu::streamSynchronize();
+}
+
 #else
 // SDC burner
 void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
                      const BaseState<Real>& p0, const Real dt_in,
-                     const Real time_in, const Vector<MultiFab>& source) {
+                     const Real time_in, const Vector<MultiFab>& source,
+                     const int burn_lev, const BurnRegion region) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::BurnerSDC()", BurnerSDC);
 
-    // Put tempbar_init on cart
-    Vector<MultiFab> p0_cart(finest_level + 1);
     const auto ispec_threshold = network_spec_index(burner_threshold_species);
 
     for (int lev = 0; lev <= finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].setVal(0.);
-    }
-    if (spherical) {
-        Put1dArrayOnCart(p0, p0_cart, false, false, bcs_f, 0);
-    }
+        if (burn_lev >= 0 && lev != burn_lev) {
+            continue;
+        }
+
+        // width of the edge of each grid that the ghost cells of s_out read
+        const IntVect ng_edge = s_out[lev].nGrowVect();
 
-    for (int lev = 0; lev <= finest_level; ++lev) {
         // create mask assuming refinement ratio = 2
         int finelev = lev + 1;
         if (lev == finest_level) finelev = finest_level;
@@ -247,24 +510,25 @@ void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
 
             const Array4<const Real> s_in_arr = s_in[lev].array(mfi);
             const Array4<Real> s_out_arr = s_out[lev].array(mfi);
-            const Array4<const Real> p0_cart_arr = p0_cart[lev].array(mfi);
             const Array4<const Real> source_arr = source[lev].array(mfi);
             const Array4<const int> mask_arr = mask.array(mfi);
+            const BaseStateView p0_view =
+                MakeBaseStateView(p0, lev, mfi, false);
 
-            const auto p0_arr = p0.const_array();
+            // the parts of the tile in the region to burn
+            const BoxList burn_boxes =
+                BurnRegionBoxes(tileBox, mfi.validbox(), ng_edge, region);
 
-            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            const auto burn_cell = [=] AMREX_GPU_DEVICE(int i, int j, int k) {
                 if (use_mask && mask_arr(i, j, k))
                     return;  // cell is covered by finer cells
 
-                auto r = (AMREX_SPACEDIM == 2) ? j : k;
-
                 Real sdc_rhoX[NumSpec];
                 for (int n = 0; n < NumSpec; ++n) {
                     sdc_rhoX[n] = source_arr(i, j, k, FirstSpec + n);
                 }
                 auto sdc_rhoh = source_arr(i, j, k, RhoH);
-                auto sdc_p0 = spherical ? p0_cart_arr(i, j, k) : p0_arr(lev, r);
+                auto sdc_p0 = p0_view(i, j, k);
 
                 auto rho_in = s_in_arr(i, j, k, Rho);
                 Real rhoX_in[NumSpec];
@@ -379,7 +643,11 @@ void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
                 s_out_arr(i, j, k, RhoH) = rhoh_out;
 
                 // pass the tracers through (currently not implemented)
-            });
+            };
+
+            for (const Box& bx : burn_boxes) {
+                ParallelFor(bx, burn_cell);
+            }
         }
     }
 }
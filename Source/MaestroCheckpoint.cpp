@@ -1,14 +1,99 @@
 
+#include <AMReX_AsyncOut.H>
 #include <AMReX_VisMF.H>
+#include <BaseStateFile.H>
 #include <Maestro.H>
 #include <Maestro_F.H>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <sstream>
 
 using namespace amrex;
 
 namespace {
 const std::string level_prefix{"Level_"};
+
+// render the checkpoint base state fields, each of nlev x nr values, as a
+// binary base state file (if base_state_binary) or as text, one line per
+// point
+std::string StageCheckPointBase(
+    const Vector<std::pair<std::string, const BaseState<Real>*>>& fields,
+    const int nlev, const int nr) {
+    if (base_state_binary) {
+        Vector<std::string> names;
+        for (const auto& field : fields) {
+            names.push_back(field.first);
+        }
+
+        BaseStateFile base;
+        base.Define(names, nlev, nr);
+        for (const auto& field : fields) {
+            const auto arr = field.second->const_array();
+            double* vals = base.Field(field.first);
+            for (int i = 0; i < nlev * nr; ++i) {
+                vals[i] = arr(i);
+            }
+        }
+        return base.Write();
+    }
+
+    std::ostringstream BaseFile;
+    BaseFile.precision(17);
+
+    for (int i = 0; i < nlev * nr; ++i) {
+        for (int n = 0; n < int(fields.size()); ++n) {
+            BaseFile << (n > 0 ? " " : "") << fields[n].second->array()(i);
+        }
+        BaseFile << "\n";
+    }
+
+    return BaseFile.str();
 }
 
+// read the checkpoint base state fields, each of nlev x nr values, from
+// either a binary base state file or the legacy text format
+void ReadCheckPointBase(
+    const std::string& File,
+    const Vector<std::pair<std::string, BaseState<Real>*>>& fields,
+    const int nlev, const int nr) {
+    Vector<char> fileCharPtr;
+    ParallelDescriptor::ReadAndBcastFile(File, fileCharPtr);
+
+    if (BaseStateFile::IsBinary(fileCharPtr.dataPtr(), fileCharPtr.size())) {
+        BaseStateFile base;
+        base.Read(fileCharPtr.dataPtr(), fileCharPtr.size(), File);
+
+        if (base.nLevels() != nlev || base.nr() != nr) {
+            Abort("ReadCheckPoint: " + File +
+                  " does not match the base state geometry");
+        }
+
+        for (const auto& field : fields) {
+            const auto arr = field.second->array();
+            const double* vals = base.Field(field.first);
+            for (int i = 0; i < nlev * nr; ++i) {
+                arr(i) = vals[i];
+            }
+        }
+        return;
+    }
+
+    std::string fileCharPtrString(fileCharPtr.dataPtr());
+    std::istringstream is(fileCharPtrString, std::istringstream::in);
+
+    std::string line, word;
+    for (int i = 0; i < nlev * nr; ++i) {
+        std::getline(is, line);
+        std::istringstream lis(line);
+        for (const auto& field : fields) {
+            lis >> word;
+            field.second->array()(i) = std::stod(word);
+        }
+    }
+}
+}  // namespace
+
 // compute S at cell-centers
 void Maestro::WriteCheckPoint(int step) {
     // chk00010            write a checkpoint file with this root directory
@@ -29,6 +114,12 @@ void Maestro::WriteCheckPoint(int step) {
 
     const int nlevels = finest_level + 1;
 
+    // checkpoints are written in the background one at a time: the
+    // previous one must be complete before the state is snapshotted again
+    if (async_checkpoint) {
+        CommitCheckPoint(true);
+    }
+
     // ---- prebuild a hierarchy of directories
     // ---- dirName is built first.  if dirName exists, it is renamed.  then build
     // ---- dirName/subDirPrefix_0 .. dirName/subDirPrefix_nlevels-1
@@ -37,21 +128,15 @@ void Maestro::WriteCheckPoint(int step) {
     // ---- ParallelDescriptor::IOProcessor() creates the directories
     amrex::PreBuildDirectorHierarchy(checkpointname, "Level_", nlevels, true);
 
-    VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+    // the Header, BaseCC and BaseFC files are staged here and written by
+    // WriteCheckPointFiles once the MultiFab data has been written
+    std::string header;
+    std::string base_cc;
+    std::string base_fc;
 
-    // write Header file
+    // stage Header file
     if (ParallelDescriptor::IOProcessor()) {
-        std::ofstream HeaderFile;
-        HeaderFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-        std::string HeaderFileName(checkpointname + "/Header");
-        HeaderFile.open(HeaderFileName.c_str(), std::ofstream::out |
-                                                    std::ofstream::trunc |
-                                                    std::ofstream::binary);
-
-        if (!HeaderFile.good()) {
-            amrex::FileOpenFailed(HeaderFileName);
-        }
-
+        std::ostringstream HeaderFile;
         HeaderFile.precision(17);
 
         // write out title line
@@ -83,6 +168,8 @@ void Maestro::WriteCheckPoint(int step) {
             HeaderFile << '\n';
         }
 
+        header = HeaderFile.str();
+
         {
             // store elapsed CPU time
             std::ofstream CPUFile;
@@ -95,72 +182,146 @@ void Maestro::WriteCheckPoint(int step) {
     }
 
     // write the MultiFab data to, e.g., chk00010/Level_0/
+    // AsyncWrite copies the data, so the state can change while the copy is
+    // being written
+    const auto write_mf = [&](const MultiFab& mf, const int lev,
+                              const std::string& name) {
+        const std::string& mf_name = amrex::MultiFabFileFullPrefix(
+            lev, checkpointname, "Level_", name);
+        if (async_checkpoint) {
+            VisMF::AsyncWrite(mf, mf_name);
+        } else {
+            VisMF::Write(mf, mf_name);
+        }
+    };
+
     for (int lev = 0; lev <= finest_level; ++lev) {
-        VisMF::Write(snew[lev], amrex::MultiFabFileFullPrefix(
-                                    lev, checkpointname, "Level_", "snew"));
-        VisMF::Write(unew[lev], amrex::MultiFabFileFullPrefix(
-                                    lev, checkpointname, "Level_", "unew"));
-        VisMF::Write(gpi[lev], amrex::MultiFabFileFullPrefix(
-                                   lev, checkpointname, "Level_", "gpi"));
-        VisMF::Write(dSdt[lev], amrex::MultiFabFileFullPrefix(
-                                    lev, checkpointname, "Level_", "dSdt"));
-        VisMF::Write(S_cc_new[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname,
-                                                   "Level_", "S_cc_new"));
+        write_mf(snew[lev], lev, "snew");
+        write_mf(unew[lev], lev, "unew");
+        write_mf(gpi[lev], lev, "gpi");
+        write_mf(dSdt[lev], lev, "dSdt");
+        write_mf(S_cc_new[lev], lev, "S_cc_new");
 #ifdef SDC
-        VisMF::Write(intra[lev], amrex::MultiFabFileFullPrefix(
-                                     lev, checkpointname, "Level_", "intra"));
+        write_mf(intra[lev], lev, "intra");
 #endif
     }
 
-    // write out the cell-centered base state
+    // stage the cell-centered and face-centered base state
     if (ParallelDescriptor::IOProcessor()) {
-        std::ofstream BaseCCFile;
-        BaseCCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-        std::string BaseCCFileName(checkpointname + "/BaseCC");
-        BaseCCFile.open(BaseCCFileName.c_str(), std::ofstream::out |
-                                                    std::ofstream::trunc |
-                                                    std::ofstream::binary);
-        if (!BaseCCFile.good()) {
-            amrex::FileOpenFailed(BaseCCFileName);
-        }
+        const int nlev = base_geom.max_radial_level + 1;
+
+        const Vector<std::pair<std::string, const BaseState<Real>*>>
+            cc_fields = {{"rho0", &rho0_new},
+                         {"p0", &p0_new},
+                         {"gamma1bar", &gamma1bar_new},
+                         {"rhoh0", &rhoh0_new},
+                         {"beta0", &beta0_new},
+                         {"psi", &psi},
+                         {"tempbar", &tempbar},
+                         {"etarho_cc", &etarho_cc},
+                         {"tempbar_init", &tempbar_init},
+                         {"p0_old", &p0_old},
+                         {"beta0_nm1", &beta0_nm1}};
+        const Vector<std::pair<std::string, const BaseState<Real>*>>
+            fc_fields = {{"w0", &w0}, {"etarho_ec", &etarho_ec}};
+
+        base_cc = StageCheckPointBase(cc_fields, nlev, base_geom.nr_fine);
+        base_fc = StageCheckPointBase(fc_fields, nlev, base_geom.nr_fine + 1);
+    }
+
+    WriteJobInfo(checkpointname);
+
+    checkpoint_in_flight = checkpointname;
+
+    if (async_checkpoint) {
+        // the background thread runs its jobs in order, so once this one
+        // is done the whole checkpoint has been written by this rank
+        auto written = std::make_shared<std::promise<void>>();
+        checkpoint_written = written->get_future();
+
+        AsyncOut::Submit([=]() {
+            WriteCheckPointFiles(checkpointname, header, base_cc, base_fc);
+            written->set_value();
+        });
+    } else {
+        WriteCheckPointFiles(checkpointname, header, base_cc, base_fc);
+        CommitCheckPoint(true);
+    }
+}
+
+// write the BaseCC and BaseFC files and the Header, as Header.tmp, into the
+// checkpoint directory.  The text is only given on the I/O processor.
+void Maestro::WriteCheckPointFiles(const std::string& checkpointname,
+                                   const std::string& header,
+                                   const std::string& base_cc,
+                                   const std::string& base_fc) {
+    if (header.empty()) {
+        return;
+    }
+
+    VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
 
-        BaseCCFile.precision(17);
-
-        for (int i = 0;
-             i < (base_geom.max_radial_level + 1) * base_geom.nr_fine; ++i) {
-            BaseCCFile << rho0_new.array()(i) << " " << p0_new.array()(i) << " "
-                       << gamma1bar_new.array()(i) << " "
-                       << rhoh0_new.array()(i) << " " << beta0_new.array()(i)
-                       << " " << psi.array()(i) << " " << tempbar.array()(i)
-                       << " " << etarho_cc.array()(i) << " "
-                       << tempbar_init.array()(i) << " " << p0_old.array()(i)
-                       << " " << beta0_nm1.array()(i) << "\n";
+    const std::vector<std::pair<std::string, const std::string*>> files = {
+        {"/BaseCC", &base_cc}, {"/BaseFC", &base_fc}, {"/Header.tmp", &header}};
+
+    for (const auto& file : files) {
+        std::ofstream File;
+        File.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+        std::string FileName(checkpointname + file.first);
+        File.open(FileName.c_str(), std::ofstream::out | std::ofstream::trunc |
+                                        std::ofstream::binary);
+        if (!File.good()) {
+            amrex::FileOpenFailed(FileName);
         }
+        File << *file.second;
+        File.close();
     }
+}
 
-    // write out the face-centered base state
-    if (ParallelDescriptor::IOProcessor()) {
-        std::ofstream BaseFCFile;
-        BaseFCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-        std::string BaseFCFileName(checkpointname + "/BaseFC");
-        BaseFCFile.open(BaseFCFileName.c_str(), std::ofstream::out |
-                                                    std::ofstream::trunc |
-                                                    std::ofstream::binary);
-        if (!BaseFCFile.good()) {
-            amrex::FileOpenFailed(BaseFCFileName);
+// rename the Header.tmp of the last checkpoint to Header once every rank
+// has finished writing it.  A checkpoint without a Header cannot be read
+// by ReadCheckPoint, so one left incomplete by a crash is never restarted
+// from.  If wait is false, only commit a background checkpoint that is
+// already complete.
+void Maestro::CommitCheckPoint(const bool wait) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::CommitCheckPoint()", CommitCheckPoint);
+
+    if (checkpoint_in_flight.empty()) {
+        return;
+    }
+
+    bool written = true;
+    if (checkpoint_written.valid()) {
+        if (wait) {
+            checkpoint_written.wait();
+        } else {
+            written = checkpoint_written.wait_for(std::chrono::seconds(0)) ==
+                      std::future_status::ready;
         }
+    }
 
-        BaseFCFile.precision(17);
+    // every rank must be done with its part
+    ParallelDescriptor::ReduceBoolAnd(written);
+    if (!written) {
+        return;
+    }
 
-        for (int i = 0;
-             i < (base_geom.max_radial_level + 1) * (base_geom.nr_fine + 1);
-             ++i) {
-            BaseFCFile << w0.array()(i) << " " << etarho_ec.array()(i) << "\n";
+    if (ParallelDescriptor::IOProcessor()) {
+        const std::string HeaderFileName(checkpoint_in_flight + "/Header");
+        if (std::rename((HeaderFileName + ".tmp").c_str(),
+                        HeaderFileName.c_str()) != 0) {
+            Abort("CommitCheckPoint: unable to rename " + HeaderFileName +
+                  ".tmp");
         }
     }
 
-    WriteJobInfo(checkpointname);
+    if (checkpoint_written.valid() && maestro_verbose > 0) {
+        Print() << "Committed checkpoint " << checkpoint_in_flight << "\n";
+    }
+
+    checkpoint_in_flight.clear();
+    checkpoint_written = std::future<void>();
 }
 
 int Maestro::ReadCheckPoint() {
@@ -171,7 +332,7 @@ int Maestro::ReadCheckPoint() {
 
     VisMF::IO_Buffer io_buffer(VisMF::GetIOBufferSize());
 
-    std::string line, word;
+    std::string line;
     int step;
 
     // Header
@@ -274,42 +435,19 @@ int Maestro::ReadCheckPoint() {
     }
 
     // BaseCC
-    {
-        std::string File(restart_file + "/BaseCC");
-        Vector<char> fileCharPtr;
-        ParallelDescriptor::ReadAndBcastFile(File, fileCharPtr);
-        std::string fileCharPtrString(fileCharPtr.dataPtr());
-        std::istringstream is(fileCharPtrString, std::istringstream::in);
-
-        // read in cell-centered base state
-        for (int i = 0;
-             i < (base_geom.max_radial_level + 1) * base_geom.nr_fine; ++i) {
-            std::getline(is, line);
-            std::istringstream lis(line);
-            lis >> word;
-            rho0_old.array()(i) = std::stod(word);
-            lis >> word;
-            p0_old.array()(i) = std::stod(word);
-            lis >> word;
-            gamma1bar_old.array()(i) = std::stod(word);
-            lis >> word;
-            rhoh0_old.array()(i) = std::stod(word);
-            lis >> word;
-            beta0_old.array()(i) = std::stod(word);
-            lis >> word;
-            psi.array()(i) = std::stod(word);
-            lis >> word;
-            tempbar.array()(i) = std::stod(word);
-            lis >> word;
-            etarho_cc.array()(i) = std::stod(word);
-            lis >> word;
-            tempbar_init.array()(i) = std::stod(word);
-            lis >> word;
-            p0_nm1.array()(i) = std::stod(word);
-            lis >> word;
-            beta0_nm1.array()(i) = std::stod(word);
-        }
-    }
+    ReadCheckPointBase(restart_file + "/BaseCC",
+                       {{"rho0", &rho0_old},
+                        {"p0", &p0_old},
+                        {"gamma1bar", &gamma1bar_old},
+                        {"rhoh0", &rhoh0_old},
+                        {"beta0", &beta0_old},
+                        {"psi", &psi},
+                        {"tempbar", &tempbar},
+                        {"etarho_cc", &etarho_cc},
+                        {"tempbar_init", &tempbar_init},
+                        {"p0_old", &p0_nm1},
+                        {"beta0_nm1", &beta0_nm1}},
+                       base_geom.max_radial_level + 1, base_geom.nr_fine);
 
     if (do_smallscale) {
         Average(sold, rho0_old, Rho);
@@ -318,25 +456,9 @@ int Maestro::ReadCheckPoint() {
     }
 
     // BaseFC
-    {
-        std::string File(restart_file + "/BaseFC");
-        Vector<char> fileCharPtr;
-        ParallelDescriptor::ReadAndBcastFile(File, fileCharPtr);
-        std::string fileCharPtrString(fileCharPtr.dataPtr());
-        std::istringstream is(fileCharPtrString, std::istringstream::in);
-
-        // read in face-centered base state
-        for (int i = 0;
-             i < (base_geom.max_radial_level + 1) * base_geom.nr_fine + 1;
-             ++i) {
-            std::getline(is, line);
-            std::istringstream lis(line);
-            lis >> word;
-            w0.array()(i) = std::stod(word);
-            lis >> word;
-            etarho_ec.array()(i) = std::stod(word);
-        }
-    }
+    ReadCheckPointBase(restart_file + "/BaseFC",
+                       {{"w0", &w0}, {"etarho_ec", &etarho_ec}},
+                       base_geom.max_radial_level + 1, base_geom.nr_fine + 1);
 
     return step;
 }
@@ -1,6 +1,7 @@
 
 #include <AMReX_buildInfo.H>
 #include <Maestro.H>
+#include <MaestroEos.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
@@ -30,12 +31,9 @@ void Maestro::DiagFile(const int step, const Real t_in,
     // -- is the radial w0 in a zone
     Vector<MultiFab> w0r_cart(finest_level + 1);
 
-    // rho_Hnuc and rho_Hext are used to determine energy generation
-    Vector<MultiFab> stemp(finest_level + 1);
+    // rho_Hnuc is used to determine energy generation; rho_Hext is only
+    // needed to get it
     Vector<MultiFab> rho_Hext(finest_level + 1);
-    Vector<MultiFab> rho_omegadot(finest_level + 1);
-    Vector<MultiFab> rho_Hnuc(finest_level + 1);
-    Vector<MultiFab> sdc_source(finest_level + 1);
 
 #if (AMREX_SPACEDIM == 3)
     if (spherical) {
@@ -65,34 +63,12 @@ void Maestro::DiagFile(const int step, const Real t_in,
     }
 #endif
 
-    // compute rho_Hext and rho_Hnuc
+    // compute rho_Hext, and rho_Hnuc if the time step didn't leave it
     for (int lev = 0; lev <= finest_level; ++lev) {
-        stemp[lev].define(grids[lev], dmap[lev], Nscal, 0);
         rho_Hext[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_omegadot[lev].define(grids[lev], dmap[lev], NumSpec, 0);
-        rho_Hnuc[lev].define(grids[lev], dmap[lev], 1, 0);
-        sdc_source[lev].define(grids[lev], dmap[lev], Nscal, 0);
-
-        sdc_source[lev].setVal(0.0);
-    }
-
-#ifndef SDC
-    if (dt < small_dt) {
-        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, small_dt,
-              t_in);
-    } else {
-        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, dt * 0.5,
-              t_in);
-    }
-#else
-    if (dt < small_dt) {
-        ReactSDC(s_in, stemp, rho_Hext, p0_in, small_dt, t_in, sdc_source);
-    } else {
-        ReactSDC(s_in, stemp, rho_Hext, p0_in, dt * 0.5, t_in, sdc_source);
     }
 
-    MakeReactionRates(rho_omegadot, rho_Hnuc, s_in);
-#endif
+    MakeReactionRatesForOutput(s_in, rho_Hext, p0_in, dt, t_in);
 
     // initialize diagnosis variables
     // diag_temp.out
@@ -114,6 +90,10 @@ void Maestro::DiagFile(const int step, const Real t_in,
     Real Rloc_enucmax = 0.0, vr_enucmax = 0.0;
     Real nuc_ener = 0.0;
 
+    // the internal energy and sound speed of s_in, if they are cached
+    const Vector<MultiFab>* eos_cache =
+        GetEosCache(s_in, {EosCache_e, EosCache_cs});
+
     for (int lev = 0; lev <= finest_level; ++lev) {
         // diagnosis variables at each level
         // diag_temp.out
@@ -139,14 +119,23 @@ void Maestro::DiagFile(const int step, const Real t_in,
         const auto dx = geom[lev].CellSizeArray();
         const auto prob_lo = geom[lev].ProbLoArray();
 
+        // in spherical geometry with even base state spacing the radial bins
+        // already mark the cells covered by finer cells with -1; otherwise
         // create mask assuming refinement ratio = 2
-        int finelev = lev + 1;
-        if (lev == finest_level) {
-            finelev = finest_level;
-        }
+        const bool use_bins = spherical && !use_exact_base_state;
+        iMultiFab fine_mask;
+        iMultiFab bins_tmp;
+        if (!use_bins) {
+            int finelev = lev + 1;
+            if (lev == finest_level) {
+                finelev = finest_level;
+            }
 
-        const BoxArray& fba = s_in[finelev].boxArray();
-        const iMultiFab& mask = makeFineMask(s_in[lev], fba, IntVect(2));
+            const BoxArray& fba = s_in[finelev].boxArray();
+            fine_mask = makeFineMask(s_in[lev], fba, IntVect(2));
+        }
+        const iMultiFab& mask =
+            use_bins ? RadialBins(lev, s_in[lev], bins_tmp) : fine_mask;
 
         // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -187,6 +176,36 @@ void Maestro::DiagFile(const int step, const Real t_in,
                 spherical ? w0r_cart[lev].array(mfi) : rho_Hnuc[lev].array(mfi);
 #endif
 
+            // call the EOS to get the sound speed and internal energy of
+            // every cell we consider below
+            const auto spherical_loc = spherical;
+            const Real sponge_start_density =
+                sponge_start_factor * sponge_center_density;
+
+            FArrayBox eos_fab(tileBox, 2, The_Managed_Arena());
+            const Array4<Real> eos_arr = eos_fab.array();
+            const Array4<const Real> cache_arr =
+                eos_cache ? (*eos_cache)[lev].const_array(mfi)
+                          : Array4<const Real>{};
+
+            EosDerivSweep(
+                tileBox, scal, cache_arr, eos_cache_idx, false, false,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                    if (use_mask && (use_bins ? mask_arr(i, j, k) < 0
+                                              : mask_arr(i, j, k) == 1)) {
+                        return false;
+                    }
+                    return !spherical_loc ||
+                           scal(i, j, k, Rho) >= sponge_start_density;
+                },
+                [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                     const eos_t& eos_state,
+                                     const eos_xderivs_t&) {
+                    eos_arr(i, j, k, 0) = eos_state.e;
+                    eos_arr(i, j, k, 1) = eos_state.cs;
+                });
+            Gpu::streamSynchronize();
+
             // The locations of the maxima here make trying to do this on the
             // GPU probably more trouble than it's worth.
             for (auto k = lo.z; k <= hi.z; ++k) {
@@ -201,7 +220,10 @@ void Maestro::DiagFile(const int step, const Real t_in,
                         // make sure the cell isn't covered by finer cells
                         bool cell_valid = true;
                         if (use_mask) {
-                            if (mask_arr(i, j, k) == 1) cell_valid = false;
+                            if (use_bins ? mask_arr(i, j, k) < 0
+                                         : mask_arr(i, j, k) == 1) {
+                                cell_valid = false;
+                            }
                         }
 
                         // For spherical, we only consider cells inside of where the
@@ -368,37 +390,17 @@ void Maestro::DiagFile(const int step, const Real t_in,
                                 }
                             }
 
-                            eos_t eos_state;
-
-                            // call the EOS to get the sound speed and internal energy
-                            eos_state.T = scal(i, j, k, Temp);
-                            eos_state.rho = scal(i, j, k, Rho);
-                            for (auto comp = 0; comp < NumSpec; ++comp) {
-                                eos_state.xn[comp] =
-                                    scal(i, j, k, FirstSpec + comp) /
-                                    eos_state.rho;
-                            }
-#if NAUX_NET > 0
-                            for (auto comp = 0; comp < NumAux; ++comp) {
-                                eos_state.aux[comp] =
-                                    scal(i, j, k, FirstAux + comp) /
-                                    eos_state.rho;
-                            }
-#endif
-
-                            eos(eos_input_rt, eos_state);
-
                             // kinetic, internal, and nuclear energies
                             kin_ener_level +=
                                 weight * scal(i, j, k, Rho) * vel * vel;
-                            int_ener_level +=
-                                weight * scal(i, j, k, Rho) * eos_state.e;
+                            int_ener_level += weight * scal(i, j, k, Rho) *
+                                              eos_arr(i, j, k, 0);
                             nuc_ener_level += weight * rho_Hnuc_arr(i, j, k);
 
                             // max vel and Mach number
                             U_max_level = amrex::max(U_max_level, vel);
-                            Mach_max_level =
-                                amrex::max(Mach_max_level, vel / eos_state.cs);
+                            Mach_max_level = amrex::max(
+                                Mach_max_level, vel / eos_arr(i, j, k, 1));
                         }
                     }
                 }
@@ -697,6 +699,12 @@ void Maestro::DiagFile(const int step, const Real t_in,
         }
     }
 
+    // diag_burn.out
+    Vector<Real> burn_diag;
+    if (do_burn_stats) {
+        BurnStatsDiag(burn_diag);
+    }
+
     // write out diagnosis data if at initialization
     if (ParallelDescriptor::IOProcessor()) {
         const std::string& diagfilename1 = "diag_temp.out";
@@ -855,6 +863,56 @@ void Maestro::DiagFile(const int step, const Real t_in,
             // close file
             diagfile3.close();
 
+            if (do_burn_stats) {
+                // diag_burn.out
+                std::ofstream diagfile4(
+                    "diag_burn.out", std::ofstream::out | std::ofstream::trunc |
+                                         std::ofstream::binary);
+                // write variable names, with the level in parentheses
+                diagfile4 << std::setw(setwVal) << std::left << "time";
+                for (int lev = 0; lev <= max_level; ++lev) {
+                    const std::string l = "(" + std::to_string(lev) + ")";
+                    diagfile4 << std::setw(setwVal) << std::left
+                              << "nburn" + l;
+                    diagfile4 << std::setw(setwVal) << std::left
+                              << "min{nsteps}" + l;
+                    diagfile4 << std::setw(setwVal) << std::left
+                              << "max{nsteps}" + l;
+                    diagfile4 << std::setw(setwVal) << std::left
+                              << "sum{nsteps}" + l;
+                    diagfile4 << std::setw(setwVal) << std::left
+                              << "min{nrhs}" + l;
+                    diagfile4 << std::setw(setwVal) << std::left
+                              << "max{nrhs}" + l;
+                    diagfile4 << std::setw(setwVal) << std::left
+                              << "sum{nrhs}" + l;
+                    diagfile4 << std::setw(setwVal) << std::left
+                              << "sum{njac}" + l;
+                    diagfile4 << std::setw(setwVal) << std::left
+                              << "nfail" + l;
+                    for (int b = 0; b < nburn_hist - 1; ++b) {
+                        diagfile4 << std::setw(setwVal) << std::left
+                                  << "nrhs<1e" + std::to_string(b + 1) + l;
+                    }
+                    diagfile4 << std::setw(setwVal) << std::left
+                              << "nrhs>=1e" + std::to_string(nburn_hist - 1) +
+                                     l;
+                }
+                diagfile4 << std::endl;
+
+                // write data
+                diagfile4.precision(outfilePrecision);
+                diagfile4 << std::scientific;
+                diagfile4 << std::setw(setwVal) << std::left << t_in;
+                for (const auto& val : burn_diag) {
+                    diagfile4 << std::setw(setwVal) << std::left << val;
+                }
+                diagfile4 << std::endl;
+
+                // close file
+                diagfile4.close();
+            }
+
         } else {
             // store variable values in data array to be written later
 
@@ -913,6 +971,16 @@ void Maestro::DiagFile(const int step, const Real t_in,
             const int idt = spherical ? 9 : 6;
             diagfile3_data[index * ndiag3 + idt] = dt;
 
+            // burn
+            if (do_burn_stats) {
+                const int ndiag4 = 1 + ndiag_burn * (max_level + 1);
+                diagfile4_data[index * ndiag4] = t_in;
+                for (auto comp = 0; comp < ndiag4 - 1; ++comp) {
+                    diagfile4_data[index * ndiag4 + comp + 1] =
+                        burn_diag[comp];
+                }
+            }
+
             index += 1;
         }
     }  // } IOProcessor
@@ -1005,7 +1073,130 @@ void Maestro::WriteDiagFile(int& index) {
         // close file
         diagfile3.close();
 
+        if (do_burn_stats) {
+            const int ndiag4 = 1 + ndiag_burn * (max_level + 1);
+
+            const std::string& diagfilename4 = "diag_burn.out";
+            std::ofstream diagfile4(diagfilename4, std::ofstream::out |
+                                                       std::ofstream::app |
+                                                       std::ofstream::binary);
+            // time
+            // for each level:
+            // -- number of burned cells
+            // -- min, max and sum of the steps
+            // -- min, max and sum of the rhs evaluations
+            // -- sum of the Jacobian evaluations
+            // -- number of failed burns
+            // -- histogram of the rhs evaluations per cell (nburn_hist)
+            diagfile4.precision(outfilePrecision);
+            diagfile4 << std::scientific;
+            for (auto i = 0; i < index; ++i) {
+                for (auto comp = 0; comp < ndiag4; ++comp) {
+                    diagfile4 << std::setw(setwVal) << std::left
+                              << diagfile4_data[i * ndiag4 + comp];
+                }
+                diagfile4 << std::endl;
+            }
+
+            // close file
+            diagfile4.close();
+        }
+
         // reset buffer array
         index = 0;
     }
 }
+
+// summarize the integration statistics of the last burn on each level
+void Maestro::BurnStatsDiag(Vector<Real>& diag) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::BurnStatsDiag()", BurnStatsDiag);
+
+    diag.resize(ndiag_burn * (max_level + 1));
+    std::fill(diag.begin(), diag.end(), 0.0);
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // create mask assuming refinement ratio = 2
+        int finelev = lev + 1;
+        if (lev == finest_level) {
+            finelev = finest_level;
+        }
+
+        const BoxArray& fba = grids[finelev];
+        const iMultiFab& mask = makeFineMask(burn_stats[lev], fba, IntVect(2));
+
+        const bool use_mask = !(lev == finest_level);
+
+        // number of burned cells, sums of the steps, rhs and Jacobian
+        // evaluations, number of failed burns, then the number of burned
+        // cells with 1-9, 10-99, ... rhs evaluations
+        Vector<Real> nsum(5 + nburn_hist, 0.0);
+        // steps and rhs evaluations
+        Vector<Real> nmin(2, std::numeric_limits<Real>::max());
+        Vector<Real> nmax(2, 0.0);
+
+        for (MFIter mfi(burn_stats[lev]); mfi.isValid(); ++mfi) {
+            const Box& validBox = mfi.validbox();
+
+            const auto lo = amrex::lbound(validBox);
+            const auto hi = amrex::ubound(validBox);
+
+            const Array4<const Real> stats = burn_stats[lev].const_array(mfi);
+            const Array4<const int> mask_arr = mask.const_array(mfi);
+
+            for (auto k = lo.z; k <= hi.z; ++k) {
+                for (auto j = lo.y; j <= hi.y; ++j) {
+                    for (auto i = lo.x; i <= hi.x; ++i) {
+                        // cells that were covered by finer cells or not
+                        // burned made no rhs evaluations
+                        const Real nrhs = stats(i, j, k, 1);
+                        if ((use_mask && mask_arr(i, j, k) == 1) ||
+                            nrhs <= 0.0) {
+                            continue;
+                        }
+
+                        const Real nsteps = stats(i, j, k, 0);
+
+                        nsum[0] += 1.0;
+                        nsum[1] += nsteps;
+                        nsum[2] += nrhs;
+                        nsum[3] += stats(i, j, k, 2);
+                        nsum[4] += stats(i, j, k, 3);
+
+                        const int b = amrex::min(int(std::log10(nrhs)),
+                                                 nburn_hist - 1);
+                        nsum[5 + b] += 1.0;
+
+                        nmin[0] = amrex::min(nmin[0], nsteps);
+                        nmin[1] = amrex::min(nmin[1], nrhs);
+                        nmax[0] = amrex::max(nmax[0], nsteps);
+                        nmax[1] = amrex::max(nmax[1], nrhs);
+                    }
+                }
+            }
+        }
+
+        ParallelDescriptor::ReduceRealSum(nsum.dataPtr(), nsum.size());
+        ParallelDescriptor::ReduceRealMin(nmin.dataPtr(), nmin.size());
+        ParallelDescriptor::ReduceRealMax(nmax.dataPtr(), nmax.size());
+
+        // no burned cells on this level
+        if (nsum[0] == 0.0) {
+            nmin[0] = nmin[1] = 0.0;
+        }
+
+        Real* d = &diag[lev * ndiag_burn];
+        d[0] = nsum[0];
+        d[1] = nmin[0];
+        d[2] = nmax[0];
+        d[3] = nsum[1];
+        d[4] = nmin[1];
+        d[5] = nmax[1];
+        d[6] = nsum[2];
+        d[7] = nsum[3];
+        d[8] = nsum[4];
+        for (int b = 0; b < nburn_hist; ++b) {
+            d[9 + b] = nsum[5 + b];
+        }
+    }
+}
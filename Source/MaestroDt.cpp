@@ -13,6 +13,8 @@ void Maestro::EstDt() {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::EstDt()", EstDt);
 
+    const Real dt_prev = dt;
+
     dt = 1.e20;
 
     // build dummy w0_force_cart and set equal to zero
@@ -458,6 +460,20 @@ void Maestro::EstDt() {
         Print() << "Minimum estdt over all levels = " << dt << std::endl;
     }
 
+    dt_limiter = "cfl";
+
+    // limit dt by the burning of the last time step
+    std::string burn_limiter;
+    const Real dt_burn = EstDtBurning(dt_prev, burn_limiter);
+    if (dt_burn < dt) {
+        dt = dt_burn;
+        dt_limiter = burn_limiter;
+        if (maestro_verbose > 0) {
+            Print() << burn_limiter << " limits the new dt = " << dt
+                    << std::endl;
+        }
+    }
+
     if (dt < small_dt) {
         Abort("EstDt: dt < small_dt");
     }
@@ -467,11 +483,13 @@ void Maestro::EstDt() {
             Print() << "max_dt limits the new dt = " << max_dt << std::endl;
         }
         dt = max_dt;
+        dt_limiter = "max_dt";
     }
 
     if (fixed_dt != -1.0) {
         // fixed dt
         dt = fixed_dt;
+        dt_limiter = "fixed_dt";
         if (maestro_verbose > 0) {
             Print() << "Setting fixed dt = " << dt << std::endl;
         }
@@ -482,6 +500,97 @@ void Maestro::EstDt() {
     rel_eps = umax;
 }
 
+Real Maestro::EstDtBurning(const Real dt_prev, std::string& limiter) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::EstDtBurning()", EstDtBurning);
+
+    Real dt_burn = 1.e50;
+
+    // don't let the burning at the last step's rates change h, or any
+    // mass fraction above nuclear_dt_X_threshold, by more than a fraction
+    // nuclear_dt_fac in one step
+    if (nuclear_dt_fac > 0.0 && have_reaction_rates) {
+        const Real X_threshold = nuclear_dt_X_threshold;
+
+        Real dt_enuc = 1.e50;
+        Real dt_spec = 1.e50;
+
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            // time for the energy generation (0) and the species creation
+            // (1) to change h and X by their own size
+            MultiFab tmp(grids[lev], dmap[lev], 2, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for (MFIter mfi(tmp, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+                // Get the index space of the valid region
+                const Box& tileBox = mfi.tilebox();
+
+                const Array4<const Real> scal_arr = sold[lev].array(mfi);
+                const Array4<const Real> rho_omegadot_arr =
+                    rho_omegadot[lev].array(mfi);
+                const Array4<const Real> rho_Hnuc_arr =
+                    rho_Hnuc[lev].array(mfi);
+                const Array4<Real> dt_arr = tmp.array(mfi);
+
+                ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
+                                                          int k) {
+                    dt_arr(i, j, k, 0) = 1.e50;
+                    dt_arr(i, j, k, 1) = 1.e50;
+
+                    const Real hnuc = amrex::Math::abs(rho_Hnuc_arr(i, j, k));
+                    if (hnuc > 0.0) {
+                        dt_arr(i, j, k, 0) =
+                            amrex::Math::abs(scal_arr(i, j, k, RhoH)) / hnuc;
+                    }
+
+                    const Real rho = scal_arr(i, j, k, Rho);
+                    for (int n = 0; n < NumSpec; ++n) {
+                        const Real rhoX = scal_arr(i, j, k, FirstSpec + n);
+                        const Real wdot =
+                            amrex::Math::abs(rho_omegadot_arr(i, j, k, n));
+                        if (rhoX >= X_threshold * rho && wdot > 0.0) {
+                            dt_arr(i, j, k, 1) =
+                                amrex::min(dt_arr(i, j, k, 1), rhoX / wdot);
+                        }
+                    }
+                });
+            }
+
+            dt_enuc = amrex::min(dt_enuc, tmp.min(0));
+            dt_spec = amrex::min(dt_spec, tmp.min(1));
+        }
+
+        if (nuclear_dt_fac * dt_enuc < dt_burn) {
+            dt_burn = nuclear_dt_fac * dt_enuc;
+            limiter = "nuclear_dt_fac (enuc)";
+        }
+        if (nuclear_dt_fac * dt_spec < dt_burn) {
+            dt_burn = nuclear_dt_fac * dt_spec;
+            limiter = "nuclear_dt_fac (species)";
+        }
+    }
+
+    // the cost of a burn is taken to scale with its length, so scale the
+    // last dt by how far the most expensive cell of the last burn was
+    // from burn_cost_target right-hand side evaluations
+    if (burn_cost_target > 0.0 && dt_prev > 0.0) {
+        Real max_nrhs = 0.0;
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            // burn_cost is 1 plus the number of rhs evaluations
+            max_nrhs = amrex::max(max_nrhs, burn_cost[lev].max(0) - 1.0);
+        }
+
+        if (max_nrhs > 0.0 && dt_prev * burn_cost_target / max_nrhs < dt_burn) {
+            dt_burn = dt_prev * burn_cost_target / max_nrhs;
+            limiter = "burn_cost_target";
+        }
+    }
+
+    return dt_burn;
+}
+
 void Maestro::FirstDt() {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::FirstDt()", FirstDt);
@@ -582,6 +691,9 @@ void Maestro::FirstDt() {
 
     Real umax = 0.;
 
+    // the sound speed of sold, if it is cached
+    const Vector<MultiFab>* eos_cache = GetEosCache(sold, {EosCache_cs});
+
     for (int lev = 0; lev <= finest_level; ++lev) {
         Real dt_lev = 1.e99;
         Real umax_lev = 0.;
@@ -610,6 +722,9 @@ void Maestro::FirstDt() {
                 const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
                 const Array4<const Real> gamma1bar_arr =
                     gamma1bar_cart[lev].array(mfi);
+                const Array4<const Real> cache_arr =
+                    eos_cache ? (*eos_cache)[lev].const_array(mfi)
+                              : Array4<const Real>{};
 
                 const Real eps = 1.e-8;
                 const Real rho_min = 1.e-20;
@@ -621,30 +736,14 @@ void Maestro::FirstDt() {
 
                 spd.setVal<RunOn::Device>(0.0, tileBox, 0, 1);
 
-                ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                    eos_t eos_state;
-
-                    // compute the sound speed from rho and temp
-                    eos_state.rho = scal_arr(i, j, k, Rho);
-                    eos_state.T = scal_arr(i, j, k, Temp);
-                    for (auto comp = 0; comp < NumSpec; ++comp) {
-                        eos_state.xn[comp] =
-                            scal_arr(i, j, k, FirstSpec + comp) /
-                            scal_arr(i, j, k, Rho);
-                    }
-#if NAUX_NET > 0
-                    for (auto comp = 0; comp < NumAux; ++comp) {
-                        eos_state.aux[comp] =
-                            scal_arr(i, j, k, FirstAux + comp) /
-                            scal_arr(i, j, k, Rho);
-                    }
-#endif
-
-                    // dens, temp, and xmass are inputs
-                    eos(eos_input_rt, eos_state);
-
-                    spd_arr(i, j, k) = eos_state.cs;
-                });
+                // compute the sound speed from rho and temp
+                EosDerivSweep(
+                    tileBox, scal_arr, cache_arr, eos_cache_idx, false, false,
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                         const eos_t& eos_state,
+                                         const eos_xderivs_t&) {
+                        spd_arr(i, j, k) = eos_state.cs;
+                    });
 
                 Real ux = uold[lev][mfi].maxabs<RunOn::Device>(tileBox, 0);
                 Real uy = uold[lev][mfi].maxabs<RunOn::Device>(tileBox, 1);
@@ -0,0 +1,145 @@
+
+#include <Maestro.H>
+#include <MaestroEos.H>
+#include <sstream>
+
+using namespace amrex;
+
+void Maestro::InitEosCache() {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::InitEosCache()", InitEosCache);
+
+    const Vector<std::string> field_names = {
+        "cp", "dpdT", "dpdr", "dedr", "p", "e", "cs", "gam1", "conductivity",
+        "dhdX", "dpdX"};
+
+    for (auto f = 0; f < EosCacheNumFields; ++f) {
+        eos_cache_idx.comp[f] = -1;
+    }
+    eos_cache_idx.ncomp = 0;
+
+    std::stringstream sstream(eos_cache_fields);
+    std::string nm;
+
+    while (sstream >> nm) {
+        auto found_name = false;
+        for (auto f = 0; f < EosCacheNumFields; ++f) {
+            if (nm != field_names[f] && nm != "all") {
+                continue;
+            }
+            found_name = true;
+
+            if (eos_cache_idx.comp[f] < 0) {
+                eos_cache_idx.comp[f] = eos_cache_idx.ncomp;
+                eos_cache_idx.ncomp +=
+                    (f == EosCache_dhdX || f == EosCache_dpdX) ? NumSpec : 1;
+            }
+        }
+
+        if (!found_name) {
+            Abort("InitEosCache: invalid eos_cache_fields entry " + nm);
+        }
+    }
+
+    if (maestro_verbose > 0 && eos_cache_idx.ncomp > 0) {
+        Print() << "Caching " << eos_cache_idx.ncomp
+                << " EOS-derived components of sold and snew" << std::endl;
+    }
+}
+
+const Vector<MultiFab>* Maestro::GetEosCache(const Vector<MultiFab>& scal,
+                                             const Vector<int>& fields) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::GetEosCache()", GetEosCache);
+
+    for (const auto f : fields) {
+        if (eos_cache_idx.comp[f] < 0) {
+            return nullptr;
+        }
+    }
+
+    if (&scal == &sold) {
+        if (eos_cache_old_version != sold_version) {
+            FillEosCache(sold, eos_cache_old);
+            eos_cache_old_version = sold_version;
+        }
+        return &eos_cache_old;
+    } else if (&scal == &snew) {
+        if (eos_cache_new_version != snew_version) {
+            FillEosCache(snew, eos_cache_new);
+            eos_cache_new_version = snew_version;
+        }
+        return &eos_cache_new;
+    }
+
+    return nullptr;
+}
+
+void Maestro::FillEosCache(const Vector<MultiFab>& scal,
+                           Vector<MultiFab>& cache) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::FillEosCache()", FillEosCache);
+
+    const auto idx = eos_cache_idx;
+    const bool derivs =
+        idx.comp[EosCache_dhdX] >= 0 || idx.comp[EosCache_dpdX] >= 0;
+    const bool cond = idx.comp[EosCache_conductivity] >= 0;
+
+    // drop the levels that no longer exist
+    cache.resize(finest_level + 1);
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // the grids may have changed since the cache was last filled
+        if (!cache[lev].ok() || cache[lev].boxArray() != grids[lev] ||
+            cache[lev].DistributionMap() != dmap[lev]) {
+            cache[lev].define(grids[lev], dmap[lev], idx.ncomp, 1);
+        }
+
+        // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(cache[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            // the consumers need one ghost cell (MakeThermalCoeffs)
+            const Box& gtbx = mfi.growntilebox(1);
+
+            const Array4<const Real> scal_arr = scal[lev].array(mfi);
+            const Array4<Real> cache_arr = cache[lev].array(mfi);
+
+            EosDerivSweep(
+                gtbx, scal_arr, Array4<const Real>{}, idx, derivs, cond,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                     const eos_t& eos_state,
+                                     const eos_xderivs_t& eos_xderivs) {
+                    EosCacheStore(cache_arr, idx, i, j, k, eos_state,
+                                  eos_xderivs);
+                });
+        }
+    }
+}
+
+void Maestro::StateModified(const MultiFab& mf, const int comp,
+                            const int ncomp) {
+    // does [comp, comp+ncomp) overlap [first, first+n)?
+    const auto overlaps = [=](const int first, const int n) {
+        return comp < first + n && first < comp + ncomp;
+    };
+
+    bool eos_input = overlaps(Rho, 1) || overlaps(Temp, 1) ||
+                     overlaps(FirstSpec, NumSpec);
+#if NAUX_NET > 0
+    eos_input = eos_input || overlaps(FirstAux, NumAux);
+#endif
+
+    if (!eos_input) {
+        return;
+    }
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        if (&mf == &sold[lev]) {
+            ++sold_version;
+        } else if (&mf == &snew[lev]) {
+            ++snew_version;
+        }
+    }
+}
@@ -1,6 +1,7 @@
 
 #include <Maestro.H>
 #include <Maestro_F.H>
+#include <sstream>
 
 using namespace amrex;
 
@@ -26,6 +27,10 @@ void Maestro::Evolve() {
         if (max_level > 0 && regrid_int > 0 && (istep - 1) % regrid_int == 0 &&
             istep != 1) {
             Regrid();
+        } else if (load_balance_type > 0 && load_balance_int > 0 &&
+                   (istep - 1) % load_balance_int == 0 && istep != 1) {
+            // rebalance the grids with the latest burn cost
+            LoadBalance();
         }
 
         dtold = dt;
@@ -41,10 +46,13 @@ void Maestro::Evolve() {
                         << " gives dt =" << dt << std::endl;
             }
 
-            // fixme - add nuclear_dt_scalefac timestep limiter
+            // EstDt has applied the cfl, burning, max_dt and fixed_dt
+            // limits; record which one limits dt this step
+            std::string limiter = dt_limiter;
 
             if (dt > max_dt_growth * dtold) {
                 dt = max_dt_growth * dtold;
+                limiter = "max_dt_growth";
                 if (maestro_verbose > 0) {
                     Print() << "dt_growth factor limits the new dt = " << dt
                             << std::endl;
@@ -57,10 +65,12 @@ void Maestro::Evolve() {
                         << "max_dt limits the new dt = " << max_dt << std::endl;
                 }
                 dt = max_dt;
+                limiter = "max_dt";
             }
 
             if (fixed_dt != -1.) {
                 dt = fixed_dt;
+                limiter = "fixed_dt";
                 if (maestro_verbose > 0) {
                     Print() << "Setting fixed dt = " << dt;
                 }
@@ -68,9 +78,15 @@ void Maestro::Evolve() {
 
             if (stop_time >= 0. && t_old + dt > stop_time) {
                 dt = amrex::min(dt, stop_time - t_old);
+                limiter = "stop_time";
                 Print() << "Stop time limits dt = " << dt << std::endl;
             }
 
+            if (maestro_verbose > 0) {
+                Print() << "step " << istep << ": dt = " << dt
+                        << " limited by " << limiter << std::endl;
+            }
+
             t_new = t_old + dt;
         }
 
@@ -136,6 +152,12 @@ void Maestro::Evolve() {
                                gamma1bar_new, unew, snew, S_cc_new);
         }
 
+        if (profile_int > 0 && istep % profile_int == 0) {
+            // append the profiles of profile_vars to profile_file
+            Print() << "\nWriting profiles " << istep << std::endl;
+            WriteProfiles(istep, t_new);
+        }
+
         if ((chk_int > 0 && istep % chk_int == 0) ||
             (chk_deltat > 0 && std::fmod(t_new, chk_deltat) < dt) ||
             ((chk_int > 0 || chk_deltat > 0) &&
@@ -145,6 +167,11 @@ void Maestro::Evolve() {
             WriteCheckPoint(istep);
         }
 
+        if (async_checkpoint) {
+            // commit the checkpoint written in the background, if complete
+            CommitCheckPoint(false);
+        }
+
         if ((diag_index == diag_buf_size || istep == max_step ||
              t_old >= stop_time) &&
             (sum_per > 0.0 || sum_interval > 0)) {
@@ -152,6 +179,12 @@ void Maestro::Evolve() {
             WriteDiagFile(diag_index);
         }
 
+        if (do_solver_log && (istep % diag_buf_size == 0 ||
+                              istep == max_step || t_old >= stop_time)) {
+            // write out the buffered solver records
+            WriteSolverLog();
+        }
+
         // move new state into old state by swapping pointers
         for (int lev = 0; lev <= finest_level; ++lev) {
             std::swap(sold[lev], snew[lev]);
@@ -159,6 +192,11 @@ void Maestro::Evolve() {
             std::swap(S_cc_old[lev], S_cc_new[lev]);
         }
 
+        // the cached EOS fields follow their state
+        std::swap(eos_cache_old, eos_cache_new);
+        std::swap(sold_version, snew_version);
+        std::swap(eos_cache_old_version, eos_cache_new_version);
+
         rho0_old.swap(rho0_new);
         rhoh0_old.swap(rhoh0_new);
         p0_nm1.swap(p0_old);
@@ -168,4 +206,8 @@ void Maestro::Evolve() {
         gamma1bar_old.swap(gamma1bar_new);
         grav_cell_old.swap(grav_cell_new);
     }
+
+    // finish writing the plotfiles and checkpoint still in flight
+    WaitForPlotFiles(0);
+    CommitCheckPoint(true);
 }
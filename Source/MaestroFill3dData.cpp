@@ -55,16 +55,10 @@ void Maestro::Put1dArrayOnCart(const int lev, const BaseState<Real>& s0,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::Put1dArrayOnCart_lev()", Put1dArrayOnCart);
 
-    const auto dx = geom[lev].CellSizeArray();
-    const auto prob_lo = geom[lev].ProbLoArray();
-    const auto& center_p = center;
-
-    const auto& r_edge_loc = base_geom.r_edge_loc;
-    const auto& r_cc_loc = base_geom.r_cc_loc;
-    const auto s0_arr = s0.const_array();
-
-    const int nr_fine = base_geom.nr_fine;
-    const int w0_interp_type_loc = w0_interp_type;
+    if (!is_output_a_vector) {
+        Put1dArrayOnCart(lev, s0, s0_cart, 0, 0, 1, is_input_edge_centered);
+        return;
+    }
 
     // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -75,263 +69,157 @@ void Maestro::Put1dArrayOnCart(const int lev, const BaseState<Real>& s0,
         const Box& tileBox = mfi.tilebox();
 
         const Array4<Real> s0_cart_arr = s0_cart.array(mfi);
+        const BaseStateView s0_view =
+            MakeBaseStateView(s0, lev, mfi, is_input_edge_centered);
 
         if (!spherical) {
-            const int outcomp = is_output_a_vector ? AMREX_SPACEDIM - 1 : 0;
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                s0_cart_arr(i, j, k, AMREX_SPACEDIM - 1) = s0_view(i, j, k);
+            });
 
+        } else {
             ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                const int r = AMREX_SPACEDIM == 2 ? j : k;
+                Real x, y, z;
+                s0_view.CellCenter(i, j, k, x, y, z);
 
-                s0_cart_arr(i, j, k, outcomp) =
-                    is_input_edge_centered
-                        ? 0.5 * (s0_arr(lev, r) + s0_arr(lev, r + 1))
-                        : s0_arr(lev, r);
+                Real radius = sqrt(x * x + y * y + z * z);
+                Real s0_cart_val = s0_view(i, j, k);
+
+                s0_cart_arr(i, j, k, 0) = s0_cart_val * x / radius;
+                s0_cart_arr(i, j, k, 1) = s0_cart_val * y / radius;
+                s0_cart_arr(i, j, k, 2) = s0_cart_val * z / radius;
             });
+        }
+    }
+}
+
+void Maestro::Put1dArrayOnCart(const int lev, const BaseState<Real>& s0,
+                               MultiFab& s0_cart, const int scomp,
+                               const int dcomp, const int ncomp,
+                               const bool is_input_edge_centered) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::Put1dArrayOnCart_comp()", Put1dArrayOnCart);
+
+    AMREX_ASSERT(scomp + ncomp <= s0.nComp());
+    AMREX_ASSERT(dcomp + ncomp <= s0_cart.nComp());
+
+    // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(s0_cart, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        // Get the index space of the valid region
+        const Box& tileBox = mfi.tilebox();
+
+        const Array4<Real> s0_cart_arr = s0_cart.array(mfi, dcomp);
+        const BaseStateView s0_view =
+            MakeBaseStateView(s0, lev, mfi, is_input_edge_centered);
+
+        if (!spherical) {
+            ParallelFor(tileBox, ncomp,
+                        [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+                            s0_cart_arr(i, j, k, n) =
+                                s0_view(i, j, k, scomp + n);
+                        });
 
         } else {
-            const Array4<const int> cc_to_r = cell_cc_to_r[lev].array(mfi);
-
-            if (use_exact_base_state) {
-                if (is_input_edge_centered) {
-                    // we implemented three different ideas for computing s0_cart,
-                    // where s0 is edge-centered.
-                    // 1.  Piecewise constant
-                    // 2.  Piecewise linear
-                    // 3.  Quadratic
-
-                    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
-                                                              int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        int index = cc_to_r(i, j, k);
-
-                        Real rfac;
-                        if (index < nr_fine) {
-                            rfac =
-                                (radius - r_edge_loc(0, index + 1)) /
-                                (r_cc_loc(0, index + 1) - r_cc_loc(0, index));
-                        } else {
-                            rfac =
-                                (radius - r_edge_loc(0, index + 1)) /
-                                (r_cc_loc(0, index) - r_cc_loc(0, index - 1));
-                        }
+            // find the stencil of each cell once and apply it to every
+            // component
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                const RadialStencil st = s0_view.CellStencil(i, j, k);
+                for (int n = 0; n < ncomp; ++n) {
+                    s0_cart_arr(i, j, k, n) = st(s0_view.s0, scomp + n);
+                }
+            });
+        }
+    }
+}
 
-                        Real s0_cart_val = 0.0;
-
-                        if (w0_interp_type_loc == 1) {
-                            s0_cart_val = rfac > 0.5 ? s0_arr(0, index + 1)
-                                                     : s0_arr(0, index);
-
-                        } else if (w0_interp_type_loc == 2) {
-                            if (index < nr_fine) {
-                                s0_cart_val = rfac * s0_arr(0, index + 1) +
-                                              (1.0 - rfac) * s0_arr(0, index);
-                            } else {
-                                s0_cart_val = s0_arr(0, nr_fine);
-                            }
-
-                        } else if (w0_interp_type_loc == 3) {
-                            if (index <= 0) {
-                                index = 0;
-                            } else if (index >= nr_fine - 1) {
-                                index = nr_fine - 2;
-                            } else if (radius - r_edge_loc(0, index) <
-                                       r_edge_loc(0, index + 1)) {
-                                index--;
-                            }
-
-                            s0_cart_val = QuadInterp(
-                                radius, r_edge_loc(0, index),
-                                r_edge_loc(0, index + 1),
-                                r_edge_loc(0, index + 2), s0_arr(0, index),
-                                s0_arr(0, index + 1), s0_arr(0, index + 2));
-                        }
+BaseStateView Maestro::MakeBaseStateView(
+    const BaseState<Real>& s0, const int lev, const MFIter& mfi,
+    const bool is_input_edge_centered) const {
+    BaseStateView view;
 
-                        if (is_output_a_vector) {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val * x / radius;
-                            s0_cart_arr(i, j, k, 1) = s0_cart_val * y / radius;
-                            s0_cart_arr(i, j, k, 2) = s0_cart_val * z / radius;
-                        } else {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val;
-                        }
-                    });
+    view.s0 = s0.const_array();
+    view.r_cc_loc = base_geom.r_cc_loc;
+    view.r_edge_loc = base_geom.r_edge_loc;
 
-                } else {  // is_input_edge_centered = 0
-                    // we directly inject the spherical values into each cell center
-                    // because s0 is also bin-centered.
-
-                    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
-                                                              int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        int index = cc_to_r(i, j, k);
-
-                        Real s0_cart_val = s0_arr(0, index);
-
-                        if (is_output_a_vector) {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val * x / radius;
-                            s0_cart_arr(i, j, k, 1) = s0_cart_val * y / radius;
-                            s0_cart_arr(i, j, k, 2) = s0_cart_val * z / radius;
-                        } else {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val;
-                        }
-                    });
-                }  // is_input_edge_centered
-
-            } else {  // use_exact_base_state = 0
-
-                const Real drf = base_geom.dr_fine;
-
-                if (is_input_edge_centered) {
-                    // we implemented three different ideas for computing s0_cart,
-                    // where s0 is edge-centered.
-                    // 1.  Piecewise constant
-                    // 2.  Piecewise linear
-                    // 3.  Quadratic
-
-                    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
-                                                              int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-
-                        auto index = int(radius / drf);
-                        Real rfac = (radius - Real(index) * drf) / drf;
-                        Real s0_cart_val = 0.0;
-
-                        if (w0_interp_type_loc == 1) {
-                            s0_cart_val = rfac > 0.5 ? s0_arr(0, index + 1)
-                                                     : s0_arr(0, index);
-
-                        } else if (w0_interp_type_loc == 2) {
-                            if (index < nr_fine) {
-                                s0_cart_val = rfac * s0_arr(0, index + 1) +
-                                              (1.0 - rfac) * s0_arr(0, index);
-                            } else {
-                                s0_cart_val = s0_arr(0, nr_fine);
-                            }
-
-                        } else if (w0_interp_type_loc == 3) {
-                            if (index <= 0) {
-                                index = 0;
-                            } else if (index >= nr_fine - 1) {
-                                index = nr_fine - 2;
-                            } else if (radius - r_edge_loc(0, index) <
-                                       r_edge_loc(0, index + 1)) {
-                                index--;
-                            }
-
-                            s0_cart_val = QuadInterp(
-                                radius, r_edge_loc(0, index),
-                                r_edge_loc(0, index + 1),
-                                r_edge_loc(0, index + 2), s0_arr(0, index),
-                                s0_arr(0, index + 1), s0_arr(0, index + 2));
-                        }
+    view.dx = geom[lev].CellSizeArray();
+    view.prob_lo = geom[lev].ProbLoArray();
+    view.center = center;
 
-                        if (is_output_a_vector) {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val * x / radius;
-                            s0_cart_arr(i, j, k, 1) = s0_cart_val * y / radius;
-                            s0_cart_arr(i, j, k, 2) = s0_cart_val * z / radius;
-                        } else {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val;
-                        }
-                    });
+    view.lev = lev;
+    view.nr_fine = base_geom.nr_fine;
+    view.dr_fine = base_geom.dr_fine;
 
-                } else {  // is_input_edge_centered = 0
-
-                    const int s0_interp_type_loc = s0_interp_type;
-
-                    // we currently have three different ideas for computing s0_cart,
-                    // where s0 is bin-centered.
-                    // 1.  Piecewise constant
-                    // 2.  Piecewise linear
-                    // 3.  Quadratic
-                    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
-                                                              int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = int(radius / drf);
-
-                        Real s0_cart_val = 0.0;
-
-                        if (s0_interp_type_loc == 1) {
-                            s0_cart_val = s0_arr(0, index);
-
-                        } else if (s0_interp_type_loc == 2) {
-                            if (radius >= r_cc_loc(0, index)) {
-                                if (index >= nr_fine - 1) {
-                                    s0_cart_val = s0_arr(0, nr_fine - 1);
-                                } else {
-                                    s0_cart_val =
-                                        s0_arr(0, index + 1) *
-                                            (radius - r_cc_loc(0, index)) /
-                                            drf +
-                                        s0_arr(0, index) *
-                                            (r_cc_loc(0, index + 1) - radius) /
-                                            drf;
-                                }
-                            } else {
-                                if (index == 0) {
-                                    s0_cart_val = s0_arr(0, index);
-                                } else if (index > nr_fine - 1) {
-                                    s0_cart_val = s0_arr(0, nr_fine - 1);
-                                } else {
-                                    s0_cart_val =
-                                        s0_arr(0, index) *
-                                            (radius - r_cc_loc(0, index - 1)) /
-                                            drf +
-                                        s0_arr(0, index - 1) *
-                                            (r_cc_loc(0, index) - radius) / drf;
-                                }
-                            }
-                        } else if (s0_interp_type_loc == 3) {
-                            if (index == 0) {
-                                index = 1;
-                            } else if (index >= nr_fine - 1) {
-                                index = nr_fine - 2;
-                            }
-
-                            s0_cart_val = QuadInterp(
-                                radius, r_cc_loc(0, index - 1),
-                                r_cc_loc(0, index), r_cc_loc(0, index + 1),
-                                s0_arr(0, index - 1), s0_arr(0, index),
-                                s0_arr(0, index + 1));
-                        }
+    view.spherical = spherical;
+    view.use_exact_base_state = use_exact_base_state;
+    view.is_edge_centered = is_input_edge_centered;
+    view.interp_type = is_input_edge_centered ? w0_interp_type : s0_interp_type;
 
-                        if (is_output_a_vector) {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val * x / radius;
-                            s0_cart_arr(i, j, k, 1) = s0_cart_val * y / radius;
-                            s0_cart_arr(i, j, k, 2) = s0_cart_val * z / radius;
-                        } else {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val;
-                        }
-                    });
-                }  // is_input_edge_centered
-            }      // use_exact_base_state
-        }
+    if (spherical && use_exact_base_state) {
+        view.cc_to_r = cell_cc_to_r[lev].array(mfi);
+    }
+
+    // use the cached stencils if they have been built on these grids
+    if (spherical) {
+        view.stencil = is_input_edge_centered
+                           ? edge_stencil[lev].const_array(mfi)
+                           : cc_stencil[lev].const_array(mfi);
+    }
+
+    return view;
+}
+
+void Maestro::Combine1dArrayWithCart(const BaseState<Real>& s0,
+                                     Vector<MultiFab>& mf, const int comp,
+                                     const BaseStateOp op,
+                                     const bool is_input_edge_centered) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::Combine1dArrayWithCart()", Combine1dArrayWithCart);
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        Combine1dArrayWithCart(lev, s0, mf[lev], comp, op,
+                               is_input_edge_centered);
+    }
+
+    // set covered coarse cells to be the average of overlying fine cells
+    AverageDown(mf, comp, 1);
+}
+
+void Maestro::Combine1dArrayWithCart(const int lev, const BaseState<Real>& s0,
+                                     MultiFab& mf, const int comp,
+                                     const BaseStateOp op,
+                                     const bool is_input_edge_centered) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::Combine1dArrayWithCart_lev()",
+                   Combine1dArrayWithCart);
+
+    // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(mf, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        // Get the index space of the valid region
+        const Box& tileBox = mfi.tilebox();
+
+        const Array4<Real> mf_arr = mf.array(mfi, comp);
+        const BaseStateView s0_view =
+            MakeBaseStateView(s0, lev, mfi, is_input_edge_centered);
+
+        ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            const Real s0_val = s0_view(i, j, k);
+
+            if (op == BaseStateOp::Copy) {
+                mf_arr(i, j, k) = s0_val;
+            } else if (op == BaseStateOp::Add) {
+                mf_arr(i, j, k) += s0_val;
+            } else if (op == BaseStateOp::Subtract) {
+                mf_arr(i, j, k) -= s0_val;
+            } else if (op == BaseStateOp::Divide) {
+                mf_arr(i, j, k) /= s0_val;
+            }
+        });
     }
 }
 
@@ -483,10 +371,8 @@ void Maestro::MakeW0mac(Vector<std::array<MultiFab, AMREX_SPACEDIM> >& w0mac) {
     }
 
     const int nr_fine = base_geom.nr_fine;
-    const int w0mac_interp_type_loc = w0mac_interp_type;
     const Real drf = base_geom.dr_fine;
     const auto w0_arr = w0.array();
-    const auto r_edge_loc = base_geom.r_edge_loc;
     const auto& center_p = center;
 
     for (int lev = 0; lev <= finest_level; ++lev) {
@@ -569,119 +455,22 @@ void Maestro::MakeW0mac(Vector<std::array<MultiFab, AMREX_SPACEDIM> >& w0mac) {
                 });
 
             } else if (w0mac_interp_type == 2 || w0mac_interp_type == 3) {
-                ParallelFor(xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                    Real x = prob_lo[0] + Real(i) * dx[0] - center_p[0];
-                    Real y = prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                    Real z = prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                    Real radius = sqrt(x * x + y * y + z * z);
-                    auto index = int(radius / drf);
-                    Real w0_cart_val;
-
-                    if (w0mac_interp_type_loc == 2) {
-                        Real rfac = (radius - Real(index) * drf) / drf;
-
-                        if (index < nr_fine) {
-                            w0_cart_val = rfac * w0_arr(0, index + 1) +
-                                          (1.0 - rfac) * w0_arr(0, index);
-                        } else {
-                            w0_cart_val = w0_arr(0, nr_fine);
-                        }
-                    } else {
-                        if (index <= 0) {
-                            index = 0;
-                        } else if (index >= nr_fine - 1) {
-                            index = nr_fine - 2;
-                        } else if (radius - r_edge_loc(0, index) <
-                                   r_edge_loc(0, index + 1)) {
-                            index--;
-                        }
-
-                        w0_cart_val = QuadInterp(
-                            radius, r_edge_loc(0, index),
-                            r_edge_loc(0, index + 1), r_edge_loc(0, index + 2),
-                            w0_arr(0, index), w0_arr(0, index + 1),
-                            w0_arr(0, index + 2));
-                    }
-
-                    w0macx(i, j, k) = w0_cart_val * x / radius;
-                });
-
-                ParallelFor(ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                    Real x = prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                    Real y = prob_lo[1] + Real(j) * dx[1] - center_p[1];
-                    Real z = prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                    Real radius = sqrt(x * x + y * y + z * z);
-                    auto index = int(radius / drf);
-                    Real w0_cart_val;
-
-                    if (w0mac_interp_type_loc == 2) {
-                        Real rfac = (radius - Real(index) * drf) / drf;
-
-                        if (index < nr_fine) {
-                            w0_cart_val = rfac * w0_arr(0, index + 1) +
-                                          (1.0 - rfac) * w0_arr(0, index);
-                        } else {
-                            w0_cart_val = w0_arr(0, nr_fine);
-                        }
-                    } else {
-                        if (index <= 0) {
-                            index = 0;
-                        } else if (index >= nr_fine - 1) {
-                            index = nr_fine - 2;
-                        } else if (radius - r_edge_loc(0, index) <
-                                   r_edge_loc(0, index + 1)) {
-                            index--;
-                        }
-
-                        w0_cart_val = QuadInterp(
-                            radius, r_edge_loc(0, index),
-                            r_edge_loc(0, index + 1), r_edge_loc(0, index + 2),
-                            w0_arr(0, index), w0_arr(0, index + 1),
-                            w0_arr(0, index + 2));
-                    }
-
-                    w0macy(i, j, k) = w0_cart_val * y / radius;
-                });
-
-                ParallelFor(zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                    Real x = prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                    Real y = prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                    Real z = prob_lo[2] + Real(k) * dx[2] - center_p[2];
-
-                    Real radius = sqrt(x * x + y * y + z * z);
-                    auto index = int(radius / drf);
-                    Real w0_cart_val;
-
-                    if (w0mac_interp_type_loc == 2) {
-                        Real rfac = (radius - Real(index) * drf) / drf;
-
-                        if (index < nr_fine) {
-                            w0_cart_val = rfac * w0_arr(0, index + 1) +
-                                          (1.0 - rfac) * w0_arr(0, index);
-                        } else {
-                            w0_cart_val = w0_arr(0, nr_fine);
-                        }
-                    } else {
-                        if (index <= 0) {
-                            index = 0;
-                        } else if (index >= nr_fine - 1) {
-                            index = nr_fine - 2;
-                        } else if (radius - r_edge_loc(0, index) <
-                                   r_edge_loc(0, index + 1)) {
-                            index--;
-                        }
-
-                        w0_cart_val = QuadInterp(
-                            radius, r_edge_loc(0, index),
-                            r_edge_loc(0, index + 1), r_edge_loc(0, index + 2),
-                            w0_arr(0, index), w0_arr(0, index + 1),
-                            w0_arr(0, index + 2));
-                    }
-
-                    w0macz(i, j, k) = w0_cart_val * z / radius;
-                });
+                BaseStateView w0_view = MakeBaseStateView(w0, lev, mfi, true);
+                w0_view.interp_type = w0mac_interp_type;
+
+                for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+                    const Box& fbx = mfi.grownnodaltilebox(dir, 1);
+                    const Array4<Real> w0mac_arr = w0mac[lev][dir].array(mfi);
+                    const RadialStencilArray stencil =
+                        w0mac_stencil[lev][dir].const_array(mfi);
+
+                    ParallelFor(fbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                        const RadialStencil st =
+                            stencil ? stencil(i, j, k)
+                                    : w0_view.FaceStencil(i, j, k, dir);
+                        w0mac_arr(i, j, k) = st(w0_view.s0);
+                    });
+                }
 
             } else if (w0mac_interp_type == 4) {
                 ParallelFor(xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
@@ -733,453 +522,47 @@ void Maestro::MakeS0mac(const BaseState<Real>& s0,
         Abort("Error: MakeS0mac assumes one ghost cell");
     }
 
-    const int nr_fine = base_geom.nr_fine;
-    const Real drf = base_geom.dr_fine;
-    const auto& r_cc_loc = base_geom.r_cc_loc;
-    const auto center_p = center;
-    const auto s0_arr = s0.const_array();
-
     for (int lev = 0; lev <= finest_level; ++lev) {
-        const auto dx = geom[lev].CellSizeArray();
-        const auto prob_lo = geom[lev].ProbLoArray();
-
         // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
         for (MFIter mfi(s0_cart[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-            // Get the index space of the valid region
-            const Box& xbx = mfi.grownnodaltilebox(0, 1);
-            const Box& ybx = mfi.grownnodaltilebox(1, 1);
-            const Box& zbx = mfi.grownnodaltilebox(2, 1);
-
-            const Array4<Real> s0macx = s0mac[lev][0].array(mfi);
-            const Array4<Real> s0macy = s0mac[lev][1].array(mfi);
-            const Array4<Real> s0macz = s0mac[lev][2].array(mfi);
             const Array4<const Real> s0_cart_arr = s0_cart[lev].array(mfi);
 
-            if (use_exact_base_state) {
-                // we currently have three different ideas for computing s0mac
-                // 1.  Interpolate s0 to cell centers, then average to edges
-                // 2.  Interpolate s0 to edges directly using linear interpolation
-                // 3.  Interpolate s0 to edges directly using quadratic interpolation
-                // 4.  Interpolate s0 to nodes, then average to edges
+            BaseStateView s0_view = MakeBaseStateView(s0, lev, mfi, false);
+            s0_view.interp_type = s0mac_interp_type;
 
-                if (s0mac_interp_type == 1) {
-                    ParallelFor(xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        s0macx(i, j, k) = 0.5 * (s0_cart_arr(i - 1, j, k) +
-                                                 s0_cart_arr(i, j, k));
-                    });
-
-                    ParallelFor(ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        s0macy(i, j, k) = 0.5 * (s0_cart_arr(i, j - 1, k) +
-                                                 s0_cart_arr(i, j, k));
-                    });
+            // we currently have three different ideas for computing s0mac
+            // 1.  Interpolate s0 to cell centers, then average to edges
+            // 2.  Interpolate s0 to edges directly using linear interpolation
+            // 3.  Interpolate s0 to edges directly using quadratic interpolation
+            // 4.  Interpolate s0 to nodes, then average to edges
 
-                    ParallelFor(zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        s0macz(i, j, k) = 0.5 * (s0_cart_arr(i, j, k - 1) +
-                                                 s0_cart_arr(i, j, k));
-                    });
-
-                } else if (s0mac_interp_type == 2) {
-                    ParallelFor(xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        Real x = prob_lo[0] + Real(i) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = (int)amrex::Math::round(
-                            radius * radius / (dx[0] * dx[0]) - 0.375);
-                        // closest radial index to edge-centered point
-
-                        if (radius >= r_cc_loc(0, index)) {
-                            Real dri =
-                                r_cc_loc(0, index + 1) - r_cc_loc(0, index);
-                            if (index >= nr_fine - 1) {
-                                s0macx(i, j, k) = s0_arr(0, nr_fine - 1);
-                            } else {
-                                s0macx(i, j, k) =
-                                    s0_arr(0, index + 1) *
-                                        (radius - r_cc_loc(0, index)) / dri +
-                                    s0_arr(0, index) *
-                                        (r_cc_loc(0, index + 1) - radius) / dri;
-                            }
-                        } else {
-                            Real dri =
-                                r_cc_loc(0, index) - r_cc_loc(0, index - 1);
-                            if (index == 0) {
-                                s0macx(i, j, k) = s0_arr(0, index);
-                            } else if (index > nr_fine - 1) {
-                                s0macx(i, j, k) = s0_arr(0, nr_fine - 1);
-                            } else {
-                                s0macx(i, j, k) =
-                                    s0_arr(0, index) *
-                                        (radius - r_cc_loc(0, index - 1)) /
-                                        dri +
-                                    s0_arr(0, index - 1) *
-                                        (r_cc_loc(0, index) - radius) / dri;
-                            }
-                        }
-                    });
-
-                    ParallelFor(ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y = prob_lo[1] + Real(j) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = (int)amrex::Math::round(
-                            radius * radius / (dx[1] * dx[1]) - 0.375);
-                        // closest radial index to edge-centered point
-
-                        if (radius >= r_cc_loc(0, index)) {
-                            Real dri =
-                                r_cc_loc(0, index + 1) - r_cc_loc(0, index);
-                            if (index >= nr_fine - 1) {
-                                s0macy(i, j, k) = s0_arr(0, nr_fine - 1);
-                            } else {
-                                s0macy(i, j, k) =
-                                    s0_arr(0, index + 1) *
-                                        (radius - r_cc_loc(0, index)) / dri +
-                                    s0_arr(0, index) *
-                                        (r_cc_loc(0, index + 1) - radius) / dri;
-                            }
-                        } else {
-                            Real dri =
-                                r_cc_loc(0, index) - r_cc_loc(0, index - 1);
-                            if (index == 0) {
-                                s0macy(i, j, k) = s0_arr(0, index);
-                            } else if (index > nr_fine - 1) {
-                                s0macy(i, j, k) = s0_arr(0, nr_fine - 1);
-                            } else {
-                                s0macy(i, j, k) =
-                                    s0_arr(0, index) *
-                                        (radius - r_cc_loc(0, index - 1)) /
-                                        dri +
-                                    s0_arr(0, index - 1) *
-                                        (r_cc_loc(0, index) - radius) / dri;
-                            }
-                        }
-                    });
-
-                    ParallelFor(zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z = prob_lo[2] + Real(k) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = (int)amrex::Math::round(
-                            radius * radius / (dx[2] * dx[2]) - 0.375);
-                        // closest radial index to edge-centered point
-
-                        if (radius >= r_cc_loc(0, index)) {
-                            Real dri =
-                                r_cc_loc(0, index + 1) - r_cc_loc(0, index);
-                            if (index >= nr_fine - 1) {
-                                s0macz(i, j, k) = s0_arr(0, nr_fine - 1);
-                            } else {
-                                s0macz(i, j, k) =
-                                    s0_arr(0, index + 1) *
-                                        (radius - r_cc_loc(0, index)) / dri +
-                                    s0_arr(0, index) *
-                                        (r_cc_loc(0, index + 1) - radius) / dri;
-                            }
-                        } else {
-                            Real dri =
-                                r_cc_loc(0, index) - r_cc_loc(0, index - 1);
-                            if (index == 0) {
-                                s0macz(i, j, k) = s0_arr(0, index);
-                            } else if (index > nr_fine - 1) {
-                                s0macz(i, j, k) = s0_arr(0, nr_fine - 1);
-                            } else {
-                                s0macz(i, j, k) =
-                                    s0_arr(0, index) *
-                                        (radius - r_cc_loc(0, index - 1)) /
-                                        dri +
-                                    s0_arr(0, index - 1) *
-                                        (r_cc_loc(0, index) - radius) / dri;
-                            }
-                        }
-                    });
-
-                } else if (s0mac_interp_type == 3) {
-                    ParallelFor(xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        Real x = prob_lo[0] + Real(i) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = (int)amrex::Math::round(
-                            radius * radius / (dx[0] * dx[0]) - 0.375);
-                        // closest radial index to edge-centered point
-
-                        // index refers to the center point in the quadratic stencil.
-                        // we need to modify this if we're too close to the edge
-                        if (index == 0) {
-                            index = 1;
-                        } else if (index >= nr_fine - 1) {
-                            index = nr_fine - 2;
-                        }
-
-                        s0macx(i, j, k) = QuadInterp(
-                            radius, r_cc_loc(0, index - 1), r_cc_loc(0, index),
-                            r_cc_loc(0, index + 1), s0_arr(0, index - 1),
-                            s0_arr(0, index), s0_arr(0, index + 1));
-                    });
-
-                    ParallelFor(ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y = prob_lo[1] + Real(j) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = (int)amrex::Math::round(
-                            radius * radius / (dx[1] * dx[1]) - 0.375);
-                        // closest radial index to edge-centered point
-
-                        // index refers to the center point in the quadratic stencil.
-                        // we need to modify this if we're too close to the edge
-                        if (index == 0) {
-                            index = 1;
-                        } else if (index >= nr_fine - 1) {
-                            index = nr_fine - 2;
-                        }
-
-                        s0macy(i, j, k) = QuadInterp(
-                            radius, r_cc_loc(0, index - 1), r_cc_loc(0, index),
-                            r_cc_loc(0, index + 1), s0_arr(0, index - 1),
-                            s0_arr(0, index), s0_arr(0, index + 1));
-                    });
-
-                    ParallelFor(zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z = prob_lo[2] + Real(k) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = (int)amrex::Math::round(
-                            radius * radius / (dx[2] * dx[2]) - 0.375);
-                        // closest radial index to edge-centered point
-
-                        // index refers to the center point in the quadratic stencil.
-                        // we need to modify this if we're too close to the edge
-                        if (index == 0) {
-                            index = 1;
-                        } else if (index >= nr_fine - 1) {
-                            index = nr_fine - 2;
-                        }
-
-                        s0macz(i, j, k) = QuadInterp(
-                            radius, r_cc_loc(0, index - 1), r_cc_loc(0, index),
-                            r_cc_loc(0, index + 1), s0_arr(0, index - 1),
-                            s0_arr(0, index), s0_arr(0, index + 1));
-                    });
-                }
-
-            } else {  // use_exact_base_state = 0
+            for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+                // Get the index space of the valid region
+                const Box& fbx = mfi.grownnodaltilebox(dir, 1);
+                const Array4<Real> s0mac_arr = s0mac[lev][dir].array(mfi);
 
                 if (s0mac_interp_type == 1) {
-                    ParallelFor(xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        s0macx(i, j, k) = 0.5 * (s0_cart_arr(i - 1, j, k) +
-                                                 s0_cart_arr(i, j, k));
-                    });
-
-                    ParallelFor(ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        s0macy(i, j, k) = 0.5 * (s0_cart_arr(i, j - 1, k) +
-                                                 s0_cart_arr(i, j, k));
-                    });
-
-                    ParallelFor(zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        s0macz(i, j, k) = 0.5 * (s0_cart_arr(i, j, k - 1) +
-                                                 s0_cart_arr(i, j, k));
-                    });
-
-                } else if (s0mac_interp_type == 2) {
-                    ParallelFor(xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        Real x = prob_lo[0] + Real(i) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = int(radius / drf);
-
-                        if (radius >= r_cc_loc(0, index)) {
-                            if (index >= nr_fine - 1) {
-                                s0macx(i, j, k) = s0_arr(0, nr_fine - 1);
-                            } else {
-                                s0macx(i, j, k) =
-                                    s0_arr(0, index + 1) *
-                                        (radius - r_cc_loc(0, index)) / drf +
-                                    s0_arr(0, index) *
-                                        (r_cc_loc(0, index + 1) - radius) / drf;
-                            }
-                        } else {
-                            if (index == 0) {
-                                s0macx(i, j, k) = s0_arr(0, index);
-                            } else if (index > nr_fine - 1) {
-                                s0macx(i, j, k) = s0_arr(0, nr_fine - 1);
-                            } else {
-                                s0macx(i, j, k) =
-                                    s0_arr(0, index) *
-                                        (radius - r_cc_loc(0, index - 1)) /
-                                        drf +
-                                    s0_arr(0, index - 1) *
-                                        (r_cc_loc(0, index) - radius) / drf;
-                            }
-                        }
-                    });
-
-                    ParallelFor(ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y = prob_lo[1] + Real(j) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = int(radius / drf);
-
-                        if (radius >= r_cc_loc(0, index)) {
-                            if (index >= nr_fine - 1) {
-                                s0macy(i, j, k) = s0_arr(0, nr_fine - 1);
-                            } else {
-                                s0macy(i, j, k) =
-                                    s0_arr(0, index + 1) *
-                                        (radius - r_cc_loc(0, index)) / drf +
-                                    s0_arr(0, index) *
-                                        (r_cc_loc(0, index + 1) - radius) / drf;
-                            }
-                        } else {
-                            if (index == 0) {
-                                s0macy(i, j, k) = s0_arr(0, index);
-                            } else if (index > nr_fine - 1) {
-                                s0macy(i, j, k) = s0_arr(0, nr_fine - 1);
-                            } else {
-                                s0macy(i, j, k) =
-                                    s0_arr(0, index) *
-                                        (radius - r_cc_loc(0, index - 1)) /
-                                        drf +
-                                    s0_arr(0, index - 1) *
-                                        (r_cc_loc(0, index) - radius) / drf;
-                            }
-                        }
-                    });
+                    const IntVect off = IntVect::TheDimensionVector(dir);
 
-                    ParallelFor(zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z = prob_lo[2] + Real(k) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = int(radius / drf);
-
-                        if (radius >= r_cc_loc(0, index)) {
-                            if (index >= nr_fine - 1) {
-                                s0macz(i, j, k) = s0_arr(0, nr_fine - 1);
-                            } else {
-                                s0macz(i, j, k) =
-                                    s0_arr(0, index + 1) *
-                                        (radius - r_cc_loc(0, index)) / drf +
-                                    s0_arr(0, index) *
-                                        (r_cc_loc(0, index + 1) - radius) / drf;
-                            }
-                        } else {
-                            if (index == 0) {
-                                s0macz(i, j, k) = s0_arr(0, index);
-                            } else if (index > nr_fine - 1) {
-                                s0macz(i, j, k) = s0_arr(0, nr_fine - 1);
-                            } else {
-                                s0macz(i, j, k) =
-                                    s0_arr(0, index) *
-                                        (radius - r_cc_loc(0, index - 1)) /
-                                        drf +
-                                    s0_arr(0, index - 1) *
-                                        (r_cc_loc(0, index) - radius) / drf;
-                            }
-                        }
-                    });
-
-                } else if (s0mac_interp_type == 3) {
-                    ParallelFor(xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        Real x = prob_lo[0] + Real(i) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = int(radius / drf);
-
-                        if (index == 0) {
-                            index = 1;
-                        } else if (index >= nr_fine - 1) {
-                            index = nr_fine - 2;
-                        }
-
-                        s0macx(i, j, k) = QuadInterp(
-                            radius, r_cc_loc(0, index - 1), r_cc_loc(0, index),
-                            r_cc_loc(0, index + 1), s0_arr(0, index - 1),
-                            s0_arr(0, index), s0_arr(0, index + 1));
+                    ParallelFor(fbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                        s0mac_arr(i, j, k) =
+                            0.5 * (s0_cart_arr(i - off[0], j - off[1],
+                                               k - off[2]) +
+                                   s0_cart_arr(i, j, k));
                     });
 
-                    ParallelFor(ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y = prob_lo[1] + Real(j) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = int(radius / drf);
-
-                        if (index == 0) {
-                            index = 1;
-                        } else if (index >= nr_fine - 1) {
-                            index = nr_fine - 2;
-                        }
+                } else if (s0mac_interp_type == 2 || s0mac_interp_type == 3) {
+                    const RadialStencilArray stencil =
+                        s0mac_stencil[lev][dir].const_array(mfi);
 
-                        s0macy(i, j, k) = QuadInterp(
-                            radius, r_cc_loc(0, index - 1), r_cc_loc(0, index),
-                            r_cc_loc(0, index + 1), s0_arr(0, index - 1),
-                            s0_arr(0, index), s0_arr(0, index + 1));
-                    });
-
-                    ParallelFor(zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z = prob_lo[2] + Real(k) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = int(radius / drf);
-
-                        if (index == 0) {
-                            index = 1;
-                        } else if (index >= nr_fine - 1) {
-                            index = nr_fine - 2;
-                        }
-
-                        s0macz(i, j, k) = QuadInterp(
-                            radius, r_cc_loc(0, index - 1), r_cc_loc(0, index),
-                            r_cc_loc(0, index + 1), s0_arr(0, index - 1),
-                            s0_arr(0, index), s0_arr(0, index + 1));
+                    ParallelFor(fbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                        const RadialStencil st =
+                            stencil ? stencil(i, j, k)
+                                    : s0_view.FaceStencil(i, j, k, dir);
+                        s0mac_arr(i, j, k) = st(s0_view.s0);
                     });
                 }
             }
@@ -1228,6 +611,17 @@ void Maestro::MakeNormal() {
                 });
             }
         }
+
+        // the radial bins used by Average are rebuilt along with the normal
+        MakeRadialBins();
+
+#if (AMREX_SPACEDIM == 3)
+        // the interpolation stencils are rebuilt along with the normal;
+        // the exact base state ones wait for MakeCCtoRadii
+        if (!use_exact_base_state) {
+            MakeRadialStencils();
+        }
+#endif
     }
 }
 
@@ -1338,5 +732,118 @@ void Maestro::MakeCCtoRadii() {
             InitBaseStateMapSphr(lev, mfi, dx_fine, dx);
         }
     }
+
+    // the exact base state stencils depend on cell_cc_to_r
+    if (use_exact_base_state) {
+        MakeRadialStencils();
+    }
+}
+
+void Maestro::MakeRadialStencils() {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeRadialStencils()", MakeRadialStencils);
+
+    if (!spherical) {
+        return;
+    }
+
+    for (int lev = 0; lev <= max_level; ++lev) {
+        cc_stencil[lev].clear();
+        edge_stencil[lev].clear();
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            s0mac_stencil[lev][dir].clear();
+            w0mac_stencil[lev][dir].clear();
+        }
+    }
+
+    if (!cache_radial_stencils) {
+        return;
+    }
+
+    // the face stencils are only used if s0mac/w0mac are interpolated
+    // directly onto the faces
+    const bool build_s0mac = s0mac_interp_type == 2 || s0mac_interp_type == 3;
+    const bool build_w0mac = w0mac_interp_type == 2 || w0mac_interp_type == 3;
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        cc_stencil[lev].define(grids[lev], dmap[lev], 0);
+        edge_stencil[lev].define(grids[lev], dmap[lev], 0);
+
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            const BoxArray& fba =
+                convert(grids[lev], IntVect::TheDimensionVector(dir));
+            if (build_s0mac) {
+                s0mac_stencil[lev][dir].define(fba, dmap[lev], 1);
+            }
+            if (build_w0mac) {
+                w0mac_stencil[lev][dir].define(fba, dmap[lev], 1);
+            }
+        }
+
+        // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(cc_stencil[lev].weight, TilingIfNotGPU());
+             mfi.isValid(); ++mfi) {
+            const Box& tileBox = mfi.tilebox();
+
+            // the stencils only depend on the geometry, so any cell- and
+            // edge-centered base state will do here
+            BaseStateView cc_view =
+                MakeBaseStateView(rho0_old, lev, mfi, false);
+            BaseStateView edge_view = MakeBaseStateView(w0, lev, mfi, true);
+
+            const Array4<Real> cc_weight = cc_stencil[lev].weight.array(mfi);
+            const Array4<int> cc_index = cc_stencil[lev].index.array(mfi);
+            const Array4<Real> edge_weight =
+                edge_stencil[lev].weight.array(mfi);
+            const Array4<int> edge_index = edge_stencil[lev].index.array(mfi);
+
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                Real x, y, z;
+                cc_view.CellCenter(i, j, k, x, y, z);
+                const Real radius = sqrt(x * x + y * y + z * z);
+
+                RadialStencilTable::Store(cc_weight, cc_index, i, j, k,
+                                          cc_view.Stencil(i, j, k, radius));
+                RadialStencilTable::Store(edge_weight, edge_index, i, j, k,
+                                          edge_view.Stencil(i, j, k, radius));
+            });
+
+            cc_view.interp_type = s0mac_interp_type;
+            edge_view.interp_type = w0mac_interp_type;
+
+            for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+                const Box& fbx = mfi.grownnodaltilebox(dir, 1);
+
+                if (build_s0mac) {
+                    const Array4<Real> weight =
+                        s0mac_stencil[lev][dir].weight.array(mfi);
+                    const Array4<int> index =
+                        s0mac_stencil[lev][dir].index.array(mfi);
+
+                    ParallelFor(fbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                        RadialStencilTable::Store(
+                            weight, index, i, j, k,
+                            cc_view.FaceStencil(i, j, k, dir));
+                    });
+                }
+
+                if (build_w0mac) {
+                    const Array4<Real> weight =
+                        w0mac_stencil[lev][dir].weight.array(mfi);
+                    const Array4<int> index =
+                        w0mac_stencil[lev][dir].index.array(mfi);
+
+                    ParallelFor(fbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                        RadialStencilTable::Store(
+                            weight, index, i, j, k,
+                            edge_view.FaceStencil(i, j, k, dir));
+                    });
+                }
+            }
+        }
+    }
 }
 #endif
@@ -28,6 +28,9 @@ void Maestro::FillPatch(int lev, Real time, MultiFab& mf,
                         Vector<MultiFab>& mf_old, Vector<MultiFab>& mf_new,
                         int srccomp, int destcomp, int ncomp, int startbccomp,
                         const Vector<BCRec>& bcs_in, int variable_type) {
+    // any EOS fields cached for mf are now out of date
+    StateModified(mf, destcomp, ncomp);
+
     Vector<BCRec> bcs{bcs_in.begin() + startbccomp,
                       bcs_in.begin() + startbccomp + ncomp};
 
@@ -147,6 +150,9 @@ void Maestro::AverageDown(Vector<MultiFab>& mf, int comp, int ncomp) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::AverageDown()", AverageDown);
 
+    // any EOS fields cached for mf are now out of date
+    StateModified(mf[0], comp, ncomp);
+
     for (int lev = finest_level - 1; lev >= 0; --lev) {
         average_down(mf[lev + 1], mf[lev], geom[lev + 1], geom[lev], comp,
                      ncomp, refRatio(lev));
@@ -1,5 +1,6 @@
 
 #include <Maestro.H>
+#include <MaestroEos.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
@@ -38,33 +39,21 @@ void Maestro::MakeGamma1bar(const Vector<MultiFab>& scal,
             const Array4<const Real> scal_arr = scal[lev].array(mfi);
             const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
 
-            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                eos_t eos_state;
-
-                eos_state.rho = scal_arr(i, j, k, Rho);
-
-                if (use_pprime_in_tfromp_loc) {
-                    eos_state.p = p0_arr(i, j, k) + scal_arr(i, j, k, Pi);
-                } else {
-                    eos_state.p = p0_arr(i, j, k);
-                }
-                eos_state.T = scal_arr(i, j, k, Temp);
-                for (auto n = 0; n < NumSpec; ++n) {
-                    eos_state.xn[n] =
-                        scal_arr(i, j, k, FirstSpec + n) / eos_state.rho;
-                }
-#if NAUX_NET > 0
-                for (auto n = 0; n < NumAux; ++n) {
-                    eos_state.aux[n] =
-                        scal_arr(i, j, k, FirstAux + n) / eos_state.rho;
-                }
-#endif
-
-                // dens, pres, and xmass are inputs
-                eos(eos_input_rp, eos_state);
-
-                gamma1_arr(i, j, k) = eos_state.gam1;
-            });
+            // dens, pres, and xmass are inputs
+            EosSweep(
+                tileBox, eos_input_rp, scal_arr,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, Real&, Real& var) {
+                    if (use_pprime_in_tfromp_loc) {
+                        var = p0_arr(i, j, k) + scal_arr(i, j, k, Pi);
+                    } else {
+                        var = p0_arr(i, j, k);
+                    }
+                    return true;
+                },
+                [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                     const eos_t& eos_state) {
+                    gamma1_arr(i, j, k) = eos_state.gam1;
+                });
         }
     }
 
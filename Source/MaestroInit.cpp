@@ -67,6 +67,13 @@ void Maestro::Init() {
             S_cc_new[lev].define(grids[lev], dmap[lev], 1, 0);
             w0_cart[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 2);
             rhcc_for_nodalproj[lev].define(grids[lev], dmap[lev], 1, 1);
+            rho_omegadot[lev].define(grids[lev], dmap[lev], NumSpec, 0);
+            rho_Hnuc[lev].define(grids[lev], dmap[lev], 1, 0);
+            burn_cost[lev].define(grids[lev], dmap[lev], 1, 0);
+            if (do_burn_stats) {
+                burn_stats[lev].define(grids[lev], dmap[lev], 4, 0);
+                burn_stats[lev].setVal(0.);
+            }
             if (spherical) {
                 normal[lev].define(grids[lev], dmap[lev], 3, 1);
                 cell_cc_to_r[lev].define(grids[lev], dmap[lev], 1, 0);
@@ -82,6 +89,9 @@ void Maestro::Init() {
         for (int lev = 0; lev <= finest_level; ++lev) {
             w0_cart[lev].setVal(0.);
             rhcc_for_nodalproj[lev].setVal(0.);
+            rho_omegadot[lev].setVal(0.);
+            rho_Hnuc[lev].setVal(0.);
+            burn_cost[lev].setVal(1.);
             pi[lev].setVal(0.);
             S_cc_new[lev].setVal(0.);
             unew[lev].setVal(0.);
@@ -197,6 +207,11 @@ void Maestro::Init() {
             InitIter();
         }
 
+        // the rates left by the divu and initial iterations come from burns
+        // over an earlier dt or of s2 rather than sold, so the initial
+        // plotfile and diagnostics burn sold themselves, as they always have
+        have_reaction_rates = false;
+
         if (plot_int > 0 || plot_deltat > 0) {
             Print() << "\nWriting plotfile 0 after all initialization"
                     << std::endl;
@@ -278,6 +293,9 @@ void Maestro::InitData() {
             // set rho0_old = rhoh0_old = 0.
             rho0_old.setVal(0.0);
             rhoh0_old.setVal(0.0);
+
+            // set tempbar to be the average
+            Average(sold, tempbar, Temp);
         } else {
             // set rho0 to be the average
             Average(sold, rho0_old, Rho);
@@ -292,12 +310,10 @@ void Maestro::InitData() {
             // call eos with r,p as input to recompute T,h
             TfromRhoP(sold, p0_old, true);
 
-            // set rhoh0 to be the average
-            Average(sold, rhoh0_old, RhoH);
+            // set rhoh0 and tempbar to be the averages
+            Average({{sold, RhoH, rhoh0_old}, {sold, Temp, tempbar}});
         }
 
-        // set tempbar to be the average
-        Average(sold, tempbar, Temp);
         tempbar_init.copy(tempbar);
     }
 
@@ -331,6 +347,13 @@ void Maestro::MakeNewLevelFromScratch(int lev, Real time, const BoxArray& ba,
     dSdt[lev].define(ba, dm, 1, 0);
     w0_cart[lev].define(ba, dm, AMREX_SPACEDIM, 2);
     rhcc_for_nodalproj[lev].define(ba, dm, 1, 1);
+    rho_omegadot[lev].define(ba, dm, NumSpec, 0);
+    rho_Hnuc[lev].define(ba, dm, 1, 0);
+    burn_cost[lev].define(ba, dm, 1, 0);
+    if (do_burn_stats) {
+        burn_stats[lev].define(ba, dm, 4, 0);
+        burn_stats[lev].setVal(0.);
+    }
 
     pi[lev].define(convert(ba, nodal_flag), dm, 1, 0);  // nodal
     intra[lev].define(ba, dm, Nscal, 0);                // for sdc
@@ -345,6 +368,9 @@ void Maestro::MakeNewLevelFromScratch(int lev, Real time, const BoxArray& ba,
     dSdt[lev].setVal(0.);
     w0_cart[lev].setVal(0.);
     rhcc_for_nodalproj[lev].setVal(0.);
+    rho_omegadot[lev].setVal(0.);
+    rho_Hnuc[lev].setVal(0.);
+    burn_cost[lev].setVal(1.);
     pi[lev].setVal(0.);
     intra[lev].setVal(0.);
 
@@ -389,9 +415,7 @@ void Maestro::InitProj() {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::InitProj()", InitProj);
 
-    Vector<MultiFab> rho_omegadot(finest_level + 1);
     Vector<MultiFab> thermal(finest_level + 1);
-    Vector<MultiFab> rho_Hnuc(finest_level + 1);
     Vector<MultiFab> rho_Hext(finest_level + 1);
     Vector<MultiFab> rhohalf(finest_level + 1);
     Vector<MultiFab> Tcoeff(finest_level + 1);
@@ -406,9 +430,7 @@ void Maestro::InitProj() {
                                          base_geom.nr_fine);
 
     for (int lev = 0; lev <= finest_level; ++lev) {
-        rho_omegadot[lev].define(grids[lev], dmap[lev], NumSpec, 0);
         thermal[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_Hnuc[lev].define(grids[lev], dmap[lev], 1, 0);
         rho_Hext[lev].define(grids[lev], dmap[lev], 1, 0);
         rhohalf[lev].define(grids[lev], dmap[lev], 1, 1);
         Tcoeff[lev].define(grids[lev], dmap[lev], 1, 1);
@@ -430,6 +452,9 @@ void Maestro::InitProj() {
         rhohalf[lev].setVal(1.);
     }
 
+    // the zeroed rates are not worth reusing for output
+    have_reaction_rates = false;
+
     // compute thermal diffusion
     if (use_thermal_diffusion) {
         MakeThermalCoeffs(sold, Tcoeff, hcoeff, Xkcoeff, pcoeff);
@@ -473,8 +498,6 @@ void Maestro::DivuIter(int istep_divu_iter) {
 
     Vector<MultiFab> stemp(finest_level + 1);
     Vector<MultiFab> rho_Hext(finest_level + 1);
-    Vector<MultiFab> rho_omegadot(finest_level + 1);
-    Vector<MultiFab> rho_Hnuc(finest_level + 1);
     Vector<MultiFab> thermal(finest_level + 1);
     Vector<MultiFab> rhohalf(finest_level + 1);
     Vector<MultiFab> Tcoeff(finest_level + 1);
@@ -502,8 +525,6 @@ void Maestro::DivuIter(int istep_divu_iter) {
     for (int lev = 0; lev <= finest_level; ++lev) {
         stemp[lev].define(grids[lev], dmap[lev], Nscal, 0);
         rho_Hext[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_omegadot[lev].define(grids[lev], dmap[lev], NumSpec, 0);
-        rho_Hnuc[lev].define(grids[lev], dmap[lev], 1, 0);
         thermal[lev].define(grids[lev], dmap[lev], 1, 0);
         rhohalf[lev].define(grids[lev], dmap[lev], 1, 1);
         Tcoeff[lev].define(grids[lev], dmap[lev], 1, 1);
@@ -519,6 +540,7 @@ void Maestro::DivuIter(int istep_divu_iter) {
 
     React(sold, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_old, 0.5 * dt,
           t_old);
+    have_reaction_rates = true;
 
     // WriteMF(sold,"a_sold_2levs");
     // Abort();
@@ -609,8 +631,6 @@ void Maestro::DivuIterSDC(int istep_divu_iter) {
 
     Vector<MultiFab> stemp(finest_level + 1);
     Vector<MultiFab> rho_Hext(finest_level + 1);
-    Vector<MultiFab> rho_omegadot(finest_level + 1);
-    Vector<MultiFab> rho_Hnuc(finest_level + 1);
     Vector<MultiFab> thermal(finest_level + 1);
     Vector<MultiFab> rhohalf(finest_level + 1);
     Vector<MultiFab> Tcoeff(finest_level + 1);
@@ -639,8 +659,6 @@ void Maestro::DivuIterSDC(int istep_divu_iter) {
     for (int lev = 0; lev <= finest_level; ++lev) {
         stemp[lev].define(grids[lev], dmap[lev], Nscal, 0);
         rho_Hext[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_omegadot[lev].define(grids[lev], dmap[lev], NumSpec, 0);
-        rho_Hnuc[lev].define(grids[lev], dmap[lev], 1, 0);
         thermal[lev].define(grids[lev], dmap[lev], 1, 0);
         rhohalf[lev].define(grids[lev], dmap[lev], 1, 1);
         Tcoeff[lev].define(grids[lev], dmap[lev], 1, 1);
@@ -670,6 +688,7 @@ void Maestro::DivuIterSDC(int istep_divu_iter) {
     }
 
     MakeReactionRates(rho_omegadot, rho_Hnuc, sold);
+    have_reaction_rates = true;
 
     // compute S at cell-centers
     Make_S_cc(S_cc_old, delta_gamma1_term, delta_gamma1, sold, uold,
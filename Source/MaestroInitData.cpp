@@ -64,54 +64,9 @@ void Maestro::InitLevelDataSphr(const int lev, const Real time, MultiFab& scal,
                     });
     }
 
-    // if we are spherical, we want to make sure that p0 is good, since that is
-    // what is needed for HSE.  Therefore, we will put p0 onto a cart array and
-    // then initialize h from rho, X, and p0.
-    MultiFab p0_cart(scal.boxArray(), scal.DistributionMap(), 1, 0);
-
-    // make a temporary MultiFab and RealVector to hold the cartesian data then copy it back to scal
-    MultiFab temp_mf(scal.boxArray(), scal.DistributionMap(), 1, 0);
-
-    BaseState<Real> temp_vec(base_geom.max_radial_level + 1, base_geom.nr_fine);
-    auto temp_arr = temp_vec.array();
-    const auto s0_init_arr = s0_init.const_array();
-
-    // initialize temperature
-    for (auto l = 0; l <= base_geom.max_radial_level; ++l) {
-        for (auto r = 0; r < base_geom.nr_fine; ++r) {
-            temp_arr(l, r) = s0_init_arr(l, r, Temp);
-        }
-    }
-
-    Put1dArrayOnCart(lev, temp_vec, temp_mf, 0, 0, bcs_f, 0);
-    MultiFab::Copy(scal, temp_mf, 0, Temp, 1, 0);
-
-    // initialize p0_cart
-    Put1dArrayOnCart(lev, p0_init, p0_cart, 0, 0);
-
-    // initialize species
-    for (auto comp = 0; comp < NumSpec; ++comp) {
-        for (auto l = 0; l <= base_geom.max_radial_level; ++l) {
-            for (auto r = 0; r < base_geom.nr_fine; ++r) {
-                temp_arr(l, r) = s0_init_arr(l, r, FirstSpec + comp);
-            }
-        }
-        Put1dArrayOnCart(lev, temp_vec, temp_mf, 0, 0, bcs_s, FirstSpec + comp);
-        MultiFab::Copy(scal, temp_mf, 0, FirstSpec + comp, 1, 0);
-    }
-
-    // initialize aux
-#if NAUX_NET > 0
-    for (auto comp = 0; comp < NumAux; ++comp) {
-        for (auto l = 0; l <= base_geom.max_radial_level; ++l) {
-            for (auto r = 0; r < base_geom.nr_fine; ++r) {
-                temp_arr(l, r) = s0_init_arr(l, r, FirstAux + comp);
-            }
-        }
-        Put1dArrayOnCart(lev, temp_vec, temp_mf, 0, 0, bcs_s, FirstAux + comp);
-        MultiFab::Copy(scal, temp_mf, 0, FirstAux + comp, 1, 0);
-    }
-#endif
+    // temperature, pi, species and aux are contiguous in both s0_init and
+    // scal, so map them onto the grid together
+    Put1dArrayOnCart(lev, s0_init, scal, Temp, Temp, Nscal - Temp);
 
 #ifdef _OPENMP
 #pragma omp parallel
@@ -119,10 +74,13 @@ void Maestro::InitLevelDataSphr(const int lev, const Real time, MultiFab& scal,
     for (MFIter mfi(scal, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
         const auto tileBox = mfi.tilebox();
 
-        const Array4<Real> vel_arr = vel.array(mfi);
         const Array4<Real> scal_arr = scal.array(mfi);
 
-        const Array4<const Real> p0_arr = p0_cart.array(mfi);
+        // if we are spherical, we want to make sure that p0 is good, since
+        // that is what is needed for HSE.  Therefore, we will evaluate p0 in
+        // each cell and then initialize h from rho, X, and p0.
+        const BaseStateView p0_view =
+            MakeBaseStateView(p0_init, lev, mfi, false);
 
         // initialize rho as sum of partial densities rho*X_i
         ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
@@ -133,7 +91,7 @@ void Maestro::InitLevelDataSphr(const int lev, const Real time, MultiFab& scal,
             // initialize (rho h) and T using the EOS
             eos_t eos_state;
             eos_state.T = scal_arr(i, j, k, Temp);
-            eos_state.p = p0_arr(i, j, k);
+            eos_state.p = p0_view(i, j, k);
             eos_state.rho = scal_arr(i, j, k, Rho);
             for (auto comp = 0; comp < NumSpec; ++comp) {
                 eos_state.xn[comp] =
@@ -150,6 +108,9 @@ void Maestro::InitLevelDataSphr(const int lev, const Real time, MultiFab& scal,
 
             scal_arr(i, j, k, RhoH) = eos_state.rho * eos_state.h;
             scal_arr(i, j, k, Temp) = eos_state.T;
+
+            // initialize pi to zero for now
+            scal_arr(i, j, k, Pi) = 0.0;
         });
     }
 }
@@ -1,5 +1,6 @@
 
 #include <Maestro.H>
+#include <MaestroEos.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
@@ -11,6 +12,12 @@ void Maestro::MakeIntraCoeffs(const Vector<MultiFab>& scal1,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeIntraCoeffs()", MakeIntraCoeffs);
 
+    // the EOS fields of scal1 and scal2, if they are cached
+    const Vector<MultiFab>* eos_cache1 =
+        GetEosCache(scal1, {EosCache_cp, EosCache_dhdX});
+    const Vector<MultiFab>* eos_cache2 =
+        GetEosCache(scal2, {EosCache_cp, EosCache_dhdX});
+
     for (int lev = 0; lev <= finest_level; ++lev) {
         Print() << "... Level " << lev << " create intra coeffs:" << std::endl;
 
@@ -26,61 +33,41 @@ void Maestro::MakeIntraCoeffs(const Vector<MultiFab>& scal1,
             const Array4<const Real> scalnew = scal2[lev].array(mfi);
             const Array4<Real> cp_arr = cp[lev].array(mfi);
             const Array4<Real> xi_arr = xi[lev].array(mfi);
-
-            ParallelFor(gtbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                // old state first
-                eos_t eos_state;
-
-                eos_state.rho = scalold(i, j, k, Rho);
-                eos_state.T = scalold(i, j, k, Temp);
-                for (auto comp = 0; comp < NumSpec; ++comp) {
-                    eos_state.xn[comp] =
-                        scalold(i, j, k, FirstSpec + comp) / eos_state.rho;
-                }
-#if NAUX_NET > 0
-                for (auto comp = 0; comp < NumAux; ++comp) {
-                    eos_state.aux[comp] =
-                        scalold(i, j, k, FirstAux + comp) / eos_state.rho;
-                }
-#endif
-
-                // dens, temp, and xmass are inputs
-                eos(eos_input_rt, eos_state);
-
-                eos_xderivs_t eos_xderivs = composition_derivatives(eos_state);
-
-                cp_arr(i, j, k) = eos_state.cp;
-
-                for (auto comp = 0; comp < NumSpec; ++comp) {
-                    xi_arr(i, j, k, comp) = eos_xderivs.dhdX[comp];
-                }
-
-                // new state now -- average results
-                eos_state.rho = scalnew(i, j, k, Rho);
-                eos_state.T = scalnew(i, j, k, Temp);
-                for (auto comp = 0; comp < NumSpec; ++comp) {
-                    eos_state.xn[comp] =
-                        scalnew(i, j, k, FirstSpec + comp) / eos_state.rho;
-                }
-#if NAUX_NET > 0
-                for (auto comp = 0; comp < NumAux; ++comp) {
-                    eos_state.aux[comp] =
-                        scalnew(i, j, k, FirstAux + comp) / eos_state.rho;
-                }
-#endif
-
-                // dens, temp, and xmass are inputs
-                eos(eos_input_rt, eos_state);
-
-                eos_xderivs = composition_derivatives(eos_state);
-
-                cp_arr(i, j, k) = 0.5 * (eos_state.cp + cp_arr(i, j, k));
-
-                for (auto comp = 0; comp < NumSpec; ++comp) {
-                    xi_arr(i, j, k, comp) =
-                        0.5 * (eos_xderivs.dhdX[comp] + xi_arr(i, j, k, comp));
-                }
-            });
+            const Array4<const Real> cacheold =
+                eos_cache1 ? (*eos_cache1)[lev].const_array(mfi)
+                           : Array4<const Real>{};
+            const Array4<const Real> cachenew =
+                eos_cache2 ? (*eos_cache2)[lev].const_array(mfi)
+                           : Array4<const Real>{};
+
+            // old state first
+            // dens, temp, and xmass are inputs
+            EosDerivSweep(
+                gtbx, scalold, cacheold, eos_cache_idx, true, false,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                     const eos_t& eos_state,
+                                     const eos_xderivs_t& eos_xderivs) {
+                    cp_arr(i, j, k) = eos_state.cp;
+
+                    for (auto comp = 0; comp < NumSpec; ++comp) {
+                        xi_arr(i, j, k, comp) = eos_xderivs.dhdX[comp];
+                    }
+                });
+
+            // new state now -- average results
+            EosDerivSweep(
+                gtbx, scalnew, cachenew, eos_cache_idx, true, false,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                     const eos_t& eos_state,
+                                     const eos_xderivs_t& eos_xderivs) {
+                    cp_arr(i, j, k) = 0.5 * (eos_state.cp + cp_arr(i, j, k));
+
+                    for (auto comp = 0; comp < NumSpec; ++comp) {
+                        xi_arr(i, j, k, comp) =
+                            0.5 * (eos_xderivs.dhdX[comp] +
+                                   xi_arr(i, j, k, comp));
+                    }
+                });
         }
     }
 
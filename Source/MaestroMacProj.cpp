@@ -132,35 +132,22 @@ void Maestro::MacProj(Vector<std::array<MultiFab, AMREX_SPACEDIM> >& umac,
         }
     }
 
-    // Set up implicit solve using MLABecLaplacian class
+    // Set up implicit solve using MLABecLaplacian class.  The operator is
+    // kept across calls, so only its coefficients are set here.
     //
-    LPInfo info;
-    info.setMetricTerm(false);
+    Real setup_start = ParallelDescriptor::second();
 
-    if (mg_bottom_solver == 4) {
-        info.setAgglomeration(true);
-        info.setConsolidation(true);
-    } else {
-        info.setAgglomeration(false);
-        info.setConsolidation(false);
-    }
-
-    // Only pass up to defined level to prevent looping over undefined grids.
-    MLABecLaplacian mlabec(Geom(0, finest_level), grids, dmap, info);
-
-    // order of stencil
-    int linop_maxorder = 2;
-    mlabec.setMaxOrder(linop_maxorder);
+    MLABecLaplacian& mlabec = MacSolver();
 
-    // set boundaries for mlabec using velocity bc's
-    SetMacSolverBCs(mlabec);
+    // start the predictor from the last predictor solution (the corrector
+    // already starts from the predictor solution)
+    const bool warm_start = warm_start_projections && is_predictor &&
+                            LoadWarmStart(mac_phi_prev, macphi, 1.0);
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         mlabec.setLevelBC(lev, &macphi[lev]);
     }
 
-    mlabec.setScalars(0.0, 1.0);
-
     for (int lev = 0; lev <= finest_level; ++lev) {
         mlabec.setACoeffs(lev, acoef[lev]);
         mlabec.setBCoeffs(lev, amrex::GetArrOfConstPtrs(face_bcoef[lev]));
@@ -175,15 +162,40 @@ void Maestro::MacProj(Vector<std::array<MultiFab, AMREX_SPACEDIM> >& umac,
     mac_mlmg.setVerbose(mg_verbose);
     mac_mlmg.setBottomVerbose(cg_verbose);
 
+    // MLMG measures the relative tolerance against the larger of the RHS
+    // and the initial residual; the residual of a good initial guess is
+    // small, so measure it against the RHS alone, as from a zero guess
+    if (warm_start) {
+        mac_mlmg.setAlwaysUseBNorm(true);
+    }
+
     // tolerance parameters taken from original MAESTRO fortran code
     const Real mac_tol_abs = -1.e0;
     const Real mac_tol_rel =
         amrex::min(eps_mac * pow(mac_level_factor, finest_level), eps_mac_max);
 
+    Real solve_start = ParallelDescriptor::second();
+    mac_solver_times.setup += solve_start - setup_start;
+
     // solve for phi
     mac_mlmg.solve(GetVecOfPtrs(macphi), GetVecOfConstPtrs(solverrhs),
                    mac_tol_rel, mac_tol_abs);
 
+    const Real solve_time = ParallelDescriptor::second() - solve_start;
+    mac_solver_times.solve += solve_time;
+    ++mac_solver_times.calls;
+    mac_solver_times.iters += mac_mlmg.getNumIters();
+    if (warm_start) {
+        ++mac_solver_times.warm_starts;
+    }
+
+    if (warm_start_projections && is_predictor) {
+        SaveWarmStart(macphi, mac_phi_prev);
+    }
+
+    LogSolve(SolverLog_mac, is_predictor ? 1 : 2, mac_mlmg, mac_tol_rel,
+             solve_start - setup_start, solve_time);
+
     // update velocity, beta0 * Utilde = beta0 * Utilde^* - B grad phi
 
     // storage for "-B grad_phi"
@@ -14,6 +14,69 @@ void Maestro::MakeEdgeScal(Vector<MultiFab>& state,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeEdgeScal()", MakeEdgeScal);
 
+    // Consecutive components that share boundary conditions are predicted
+    // together, up to edge_scal_batch_size at a time, with the component
+    // loop innermost in each kernel so the face velocities are swept once
+    // per batch rather than once per component.
+    Vector<int> batch_start;
+    Vector<int> batch_size;
+    const int max_batch = amrex::max(edge_scal_batch_size, 1);
+    for (int n = 0; n < num_comp; ++n) {
+        if (n == 0 || batch_size.back() == max_batch ||
+            !(bcs[start_bccomp + n] ==
+              bcs[start_bccomp + batch_start.back()])) {
+            batch_start.push_back(n);
+            batch_size.push_back(1);
+        } else {
+            batch_size.back()++;
+        }
+    }
+    const int num_batches = batch_start.size();
+    int nbatch = 0;
+    for (auto nb : batch_size) {
+        nbatch = amrex::max(nbatch, nb);
+    }
+
+    // All of the intermediate states live in a single scratch FArrayBox that
+    // covers the tile grown by one cell.  It is shared by every batch of the
+    // tile, so all of the work for a tile is done while its data is still
+    // in cache.  Face-centered quantities are indexed
+    // by face, exactly as they were in level-wide MultiFabs with 1 ghost cell.
+    // Each quantity has nbatch components (AMREX_SPACEDIM * nbatch for the
+    // PPM interface states).
+
+    // components of the scratch space
+    const int Ip_comp = 0;
+    const int Im_comp = Ip_comp + AMREX_SPACEDIM * nbatch;
+    const int slx_comp = Im_comp + AMREX_SPACEDIM * nbatch;
+    const int srx_comp = slx_comp + nbatch;
+    const int simhx_comp = srx_comp + nbatch;
+    const int sly_comp = simhx_comp + nbatch;
+    const int sry_comp = sly_comp + nbatch;
+    const int simhy_comp = sry_comp + nbatch;
+#if (AMREX_SPACEDIM == 2)
+    const int nscratch_base = simhy_comp + nbatch;
+#else
+    const int slz_comp = simhy_comp + nbatch;
+    const int srz_comp = slz_comp + nbatch;
+    const int simhz_comp = srz_comp + nbatch;
+    const int simhxy_comp = simhz_comp + nbatch;
+    const int simhxz_comp = simhxy_comp + nbatch;
+    const int simhyx_comp = simhxz_comp + nbatch;
+    const int simhyz_comp = simhyx_comp + nbatch;
+    const int simhzx_comp = simhyz_comp + nbatch;
+    const int simhzy_comp = simhzx_comp + nbatch;
+    const int slopez_comp = simhzy_comp + nbatch;
+    const int divu_comp = slopez_comp + nbatch;
+    const int nscratch_base = divu_comp + 1;
+#endif
+    // the traced forces are only stored if we need them
+    const int Ipf_comp = nscratch_base;
+    const int Imf_comp = Ipf_comp + AMREX_SPACEDIM * nbatch;
+    const int nscratch = (ppm_trace_forces == 1)
+                             ? Imf_comp + AMREX_SPACEDIM * nbatch
+                             : nscratch_base;
+
     for (int lev = 0; lev <= finest_level; ++lev) {
         // Get the index space and grid spacing of the domain
         const Box& domainBox = geom[lev].Domain();
@@ -22,76 +85,7 @@ void Maestro::MakeEdgeScal(Vector<MultiFab>& state,
         // get references to the MultiFabs at level lev
         const MultiFab& scal_mf = state[lev];
 
-        MultiFab Ip, Im, Ipf, Imf;
-        Ip.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Im.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Ipf.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Imf.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-
-        MultiFab slx, srx, simhx;
-        slx.define(grids[lev], dmap[lev], 1, 1);
-        srx.define(grids[lev], dmap[lev], 1, 1);
-        simhx.define(grids[lev], dmap[lev], 1, 1);
-
-        MultiFab sly, sry, simhy;
-        sly.define(grids[lev], dmap[lev], 1, 1);
-        sry.define(grids[lev], dmap[lev], 1, 1);
-        simhy.define(grids[lev], dmap[lev], 1, 1);
-
-        slx.setVal(0.);
-        srx.setVal(0.);
-        simhx.setVal(0.);
-        sly.setVal(0.);
-        sry.setVal(0.);
-        simhy.setVal(0.);
-
-#if (AMREX_SPACEDIM == 3)
-
-        MultiFab slopez, divu;
-        slopez.define(grids[lev], dmap[lev], 1, 1);
-        divu.define(grids[lev], dmap[lev], 1, 1);
-
-        MultiFab slz, srz, simhz;
-        slz.define(grids[lev], dmap[lev], 1, 1);
-        srz.define(grids[lev], dmap[lev], 1, 1);
-        simhz.define(grids[lev], dmap[lev], 1, 1);
-
-        MultiFab simhxy, simhxz, simhyx, simhyz, simhzx, simhzy;
-        simhxy.define(grids[lev], dmap[lev], 1, 1);
-        simhxz.define(grids[lev], dmap[lev], 1, 1);
-        simhyx.define(grids[lev], dmap[lev], 1, 1);
-        simhyz.define(grids[lev], dmap[lev], 1, 1);
-        simhzx.define(grids[lev], dmap[lev], 1, 1);
-        simhzy.define(grids[lev], dmap[lev], 1, 1);
-
-        slx.setVal(0.);
-        srx.setVal(0.);
-        simhx.setVal(0.);
-        sly.setVal(0.);
-        sry.setVal(0.);
-        simhy.setVal(0.);
-        slz.setVal(0.);
-        srz.setVal(0.);
-        simhz.setVal(0.);
-
-        simhxy.setVal(0.);
-        simhxz.setVal(0.);
-        simhyx.setVal(0.);
-        simhyz.setVal(0.);
-        simhzx.setVal(0.);
-        simhzy.setVal(0.);
-#endif
-
-        // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
-#if (AMREX_SPACEDIM == 2)
-
-        Vector<MultiFab> vec_scal_mf(num_comp);
-        for (int comp = 0; comp < num_comp; ++comp) {
-            vec_scal_mf[comp].define(grids[lev], dmap[lev], 1, scal_mf.nGrow());
-
-            MultiFab::Copy(vec_scal_mf[comp], scal_mf, start_scomp + comp, 0, 1,
-                           scal_mf.nGrow());
-        }
+        // loop over boxes (mfi must take a cell-centered MultiFab)
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
@@ -100,197 +94,168 @@ void Maestro::MakeEdgeScal(Vector<MultiFab>& state,
             const Box& tileBox = mfi.tilebox();
             const Box& obx = amrex::grow(tileBox, 1);
 
-            // Be careful to pass in comp+1 for fortran indexing
-            for (int scomp = start_scomp; scomp < start_scomp + num_comp;
-                 ++scomp) {
-                int vcomp = scomp - start_scomp;
-                int bccomp = start_bccomp + scomp - start_scomp;
+            // the async arena only reuses the memory once the kernels
+            // working on this tile have completed
+            FArrayBox scratch(obx, nscratch, The_Async_Arena());
+            Array4<Real> const scratch_arr = scratch.array();
 
-                Array4<Real> const scal_arr = state[lev].array(mfi);
+            Array4<Real> const Ip_arr(scratch_arr, Ip_comp);
+            Array4<Real> const Im_arr(scratch_arr, Im_comp);
+            // the traced forces only have components in the scratch if
+            // ppm_trace_forces == 1, and are never touched otherwise
+            Array4<Real> const Ipf_arr =
+                (ppm_trace_forces == 1) ? Array4<Real>(scratch_arr, Ipf_comp)
+                                        : Array4<Real>{};
+            Array4<Real> const Imf_arr =
+                (ppm_trace_forces == 1) ? Array4<Real>(scratch_arr, Imf_comp)
+                                        : Array4<Real>{};
 
-                Array4<Real> const umac_arr = umac[lev][0].array(mfi);
-                Array4<Real> const vmac_arr = umac[lev][1].array(mfi);
+            Array4<Real> const slx_arr(scratch_arr, slx_comp);
+            Array4<Real> const srx_arr(scratch_arr, srx_comp);
+            Array4<Real> const sly_arr(scratch_arr, sly_comp);
+            Array4<Real> const sry_arr(scratch_arr, sry_comp);
 
-                Array4<Real> const slx_arr = slx.array(mfi);
-                Array4<Real> const srx_arr = srx.array(mfi);
-                Array4<Real> const sly_arr = sly.array(mfi);
-                Array4<Real> const sry_arr = sry.array(mfi);
+            Array4<Real> const simhx_arr(scratch_arr, simhx_comp);
+            Array4<Real> const simhy_arr(scratch_arr, simhy_comp);
 
-                Array4<Real> const simhx_arr = simhx.array(mfi);
-                Array4<Real> const simhy_arr = simhy.array(mfi);
+            Array4<Real> const scal_arr = state[lev].array(mfi);
+            Array4<Real> const force_arr = force[lev].array(mfi);
 
-                if (ppm_type == 0) {
-                    // we're going to reuse Ip here as slopex and Im as slopey
-                    // as they have the correct number of ghost zones
+            Array4<Real> const umac_arr = umac[lev][0].array(mfi);
+            Array4<Real> const vmac_arr = umac[lev][1].array(mfi);
 
-                    // x-direction
-                    Slopex(obx, vec_scal_mf[vcomp].array(mfi), Ip.array(mfi),
-                           domainBox, bcs, 1, bccomp);
-
-                    // y-direction
-                    Slopey(obx, vec_scal_mf[vcomp].array(mfi), Im.array(mfi),
-                           domainBox, bcs, 1, bccomp);
-
-                } else {
-                    PPM(obx, scal_arr, umac_arr, vmac_arr, Ip.array(mfi),
-                        Im.array(mfi), domainBox, bcs, dx, true, scomp, bccomp);
-
-                    if (ppm_trace_forces == 1) {
-                        PPM(obx, force[lev].array(mfi), umac_arr, vmac_arr,
-                            Ipf.array(mfi), Imf.array(mfi), domainBox, bcs, dx,
-                            true, scomp, bccomp);
-                    }
-                }
+            Array4<Real> const sedgex_arr = sedge[lev][0].array(mfi);
+            Array4<Real> const sedgey_arr = sedge[lev][1].array(mfi);
 
-                Gpu::synchronize();
-
-                // Create s_{\i-\half\e_x}^x, etc.
-
-                MakeEdgeScalPredictor(
-                    mfi, slx_arr, srx_arr, sly_arr, sry_arr, scal_arr,
-                    Ip.array(mfi), Im.array(mfi), umac_arr, vmac_arr, simhx_arr,
-                    simhy_arr, domainBox, bcs, dx, scomp, bccomp, is_vel);
-
-                Gpu::synchronize();
-
-                Array4<Real> const sedgex_arr = sedge[lev][0].array(mfi);
-                Array4<Real> const sedgey_arr = sedge[lev][1].array(mfi);
+#if (AMREX_SPACEDIM == 3)
+            Array4<Real> const slz_arr(scratch_arr, slz_comp);
+            Array4<Real> const srz_arr(scratch_arr, srz_comp);
+            Array4<Real> const simhz_arr(scratch_arr, simhz_comp);
+
+            Array4<Real> const simhxy_arr(scratch_arr, simhxy_comp);
+            Array4<Real> const simhxz_arr(scratch_arr, simhxz_comp);
+            Array4<Real> const simhyx_arr(scratch_arr, simhyx_comp);
+            Array4<Real> const simhyz_arr(scratch_arr, simhyz_comp);
+            Array4<Real> const simhzx_arr(scratch_arr, simhzx_comp);
+            Array4<Real> const simhzy_arr(scratch_arr, simhzy_comp);
+
+            Array4<Real> const slopez_arr(scratch_arr, slopez_comp);
+            Array4<Real> const divu_arr(scratch_arr, divu_comp);
+
+            Array4<Real> const wmac_arr = umac[lev][2].array(mfi);
+            Array4<Real> const sedgez_arr = sedge[lev][2].array(mfi);
+
+            // make divu -- this is the same for every component
+            if (is_conservative) {
+                MakeDivU(obx, divu_arr, umac_arr, vmac_arr, wmac_arr, dx);
+            }
+#endif
 
-                // Create sedgelx, etc.
+            for (int ib = 0; ib < num_batches; ++ib) {
+                const int scomp = start_scomp + batch_start[ib];
+                const int bccomp = start_bccomp + batch_start[ib];
+                const int ncomp = batch_size[ib];
 
-                MakeEdgeScalEdges(mfi, slx_arr, srx_arr, sly_arr, sry_arr,
-                                  scal_arr, sedgex_arr, sedgey_arr,
-                                  force[lev].array(mfi), umac_arr, vmac_arr,
-                                  Ipf.array(mfi), Imf.array(mfi), simhx_arr,
-                                  simhy_arr, domainBox, bcs, dx, scomp, bccomp,
-                                  is_vel, is_conservative);
-            }  // end loop over components
-        }      // end MFIter loop
+                // the slopes and PPM are computed one component at a
+                // time, into that component's slot in the scratch space
+                for (int n = 0; n < ncomp; ++n) {
+                    Array4<Real> const Ipn_arr(Ip_arr, AMREX_SPACEDIM * n);
+                    Array4<Real> const Imn_arr(Im_arr, AMREX_SPACEDIM * n);
 
-#elif (AMREX_SPACEDIM == 3)
+                    if (ppm_type == 0) {
+                        // we're going to reuse Ip here as slopex and Im as
+                        // slopey as they have the correct number of ghost
+                        // zones
 
-        Vector<MultiFab> vec_scal_mf(num_comp);
-        for (int comp = 0; comp < num_comp; ++comp) {
-            vec_scal_mf[comp].define(grids[lev], dmap[lev], 1, scal_mf.nGrow());
-            vec_scal_mf[comp].setVal(0.);
+                        // the slopes are computed on component 0 of their
+                        // input, so offset the state to scomp+n
+                        Array4<Real> const scal_comp_arr(scal_arr,
+                                                         scomp + n);
 
-            MultiFab::Copy(vec_scal_mf[comp], scal_mf, start_scomp + comp, 0, 1,
-                           scal_mf.nGrow());
-        }
+                        // x-direction
+                        Slopex(obx, scal_comp_arr, Ipn_arr, domainBox, bcs,
+                               1, bccomp + n);
 
-        for (int scomp = start_scomp; scomp < start_scomp + num_comp; ++scomp) {
-            int vcomp = scomp - start_scomp;
-            int bccomp = start_bccomp + scomp - start_scomp;
+                        // y-direction
+                        Slopey(obx, scal_comp_arr, Imn_arr, domainBox, bcs,
+                               1, bccomp + n);
 
-#ifdef _OPENMP
-#pragma omp parallel
+#if (AMREX_SPACEDIM == 3)
+                        // z-direction
+                        Slopez(obx, scal_comp_arr,
+                               Array4<Real>(slopez_arr, n), domainBox, bcs,
+                               1, bccomp + n);
 #endif
-            for (MFIter mfi(scal_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-                // Get the index space of the valid region
-                const Box& tileBox = mfi.tilebox();
-                const Box& obx = amrex::grow(tileBox, 1);
-
-                Array4<Real> const umac_arr = umac[lev][0].array(mfi);
-                Array4<Real> const vmac_arr = umac[lev][1].array(mfi);
-                Array4<Real> const wmac_arr = umac[lev][2].array(mfi);
-
-                // make divu
-                if (is_conservative) {
-                    MakeDivU(obx, divu.array(mfi), umac_arr, vmac_arr, wmac_arr,
-                             dx);
-                }
-
-                if (ppm_type == 0) {
-                    // we're going to reuse Ip here as slopex and Im as slopey
-                    // as they have the correct number of ghost zones
-
-                    // x-direction
-                    Slopex(obx, vec_scal_mf[vcomp].array(mfi), Ip.array(mfi),
-                           domainBox, bcs, 1, bccomp);
-
-                    // y-direction
-                    Slopey(obx, vec_scal_mf[vcomp].array(mfi), Im.array(mfi),
-                           domainBox, bcs, 1, bccomp);
-
-                    // z-direction
-                    Slopez(obx, vec_scal_mf[vcomp].array(mfi),
-                           slopez.array(mfi), domainBox, bcs, 1, bccomp);
-
-                } else {
-                    PPM(obx, state[lev].array(mfi), umac_arr, vmac_arr,
-                        wmac_arr, Ip.array(mfi), Im.array(mfi), domainBox, bcs,
-                        dx, true, scomp, bccomp);
+                    } else {
+                        PPM(obx, scal_arr, umac_arr, vmac_arr,
+#if (AMREX_SPACEDIM == 3)
+                            wmac_arr,
+#endif
+                            Ipn_arr, Imn_arr, domainBox, bcs, dx, true,
+                            scomp + n, bccomp + n);
 
-                    if (ppm_trace_forces == 1) {
-                        PPM(obx, force[lev].array(mfi), umac_arr, vmac_arr,
-                            wmac_arr, Ipf.array(mfi), Imf.array(mfi), domainBox,
-                            bcs, dx, true, scomp, bccomp);
+                        if (ppm_trace_forces == 1) {
+                            PPM(obx, force_arr, umac_arr, vmac_arr,
+#if (AMREX_SPACEDIM == 3)
+                                wmac_arr,
+#endif
+                                Array4<Real>(Ipf_arr, AMREX_SPACEDIM * n),
+                                Array4<Real>(Imf_arr, AMREX_SPACEDIM * n),
+                                domainBox, bcs, dx, true, scomp + n,
+                                bccomp + n);
+                        }
                     }
                 }
-            }
 
-#ifdef _OPENMP
-#pragma omp parallel
-#endif
-            for (MFIter mfi(scal_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-                Array4<Real> const scal_arr = state[lev].array(mfi);
-
-                Array4<Real> const umac_arr = umac[lev][0].array(mfi);
-                Array4<Real> const vmac_arr = umac[lev][1].array(mfi);
-                Array4<Real> const wmac_arr = umac[lev][2].array(mfi);
+#if (AMREX_SPACEDIM == 2)
+                // Create s_{\i-\half\e_x}^x, etc.
 
-                Array4<Real> const slx_arr = slx.array(mfi);
-                Array4<Real> const srx_arr = srx.array(mfi);
-                Array4<Real> const sly_arr = sly.array(mfi);
-                Array4<Real> const sry_arr = sry.array(mfi);
-                Array4<Real> const slz_arr = slz.array(mfi);
-                Array4<Real> const srz_arr = srz.array(mfi);
+                MakeEdgeScalPredictor(mfi, slx_arr, srx_arr, sly_arr,
+                                      sry_arr, scal_arr, Ip_arr, Im_arr,
+                                      umac_arr, vmac_arr, simhx_arr,
+                                      simhy_arr, domainBox, bcs, dx, scomp,
+                                      bccomp, ncomp, is_vel);
 
-                Array4<Real> const simhx_arr = simhx.array(mfi);
-                Array4<Real> const simhy_arr = simhy.array(mfi);
-                Array4<Real> const simhz_arr = simhz.array(mfi);
+                // Create sedgelx, etc.
 
+                MakeEdgeScalEdges(mfi, slx_arr, srx_arr, sly_arr, sry_arr,
+                                  scal_arr, sedgex_arr, sedgey_arr,
+                                  force_arr, umac_arr, vmac_arr, Ipf_arr,
+                                  Imf_arr, simhx_arr, simhy_arr, domainBox,
+                                  bcs, dx, scomp, bccomp, ncomp, is_vel,
+                                  is_conservative);
+#else
                 // Create s_{\i-\half\e_x}^x, etc.
 
                 MakeEdgeScalPredictor(
-                    mfi, slx_arr, srx_arr, sly_arr, sry_arr, slz_arr, srz_arr,
-                    scal_arr, Ip.array(mfi), Im.array(mfi), slopez.array(mfi),
-                    umac_arr, vmac_arr, wmac_arr, simhx_arr, simhy_arr,
-                    simhz_arr, domainBox, bcs, dx, scomp, bccomp, is_vel);
-
-                Array4<Real> const simhxy_arr = simhxy.array(mfi);
-                Array4<Real> const simhxz_arr = simhxz.array(mfi);
-                Array4<Real> const simhyx_arr = simhyx.array(mfi);
-                Array4<Real> const simhyz_arr = simhyz.array(mfi);
-                Array4<Real> const simhzx_arr = simhzx.array(mfi);
-                Array4<Real> const simhzy_arr = simhzy.array(mfi);
+                    mfi, slx_arr, srx_arr, sly_arr, sry_arr, slz_arr,
+                    srz_arr, scal_arr, Ip_arr, Im_arr, slopez_arr, umac_arr,
+                    vmac_arr, wmac_arr, simhx_arr, simhy_arr, simhz_arr,
+                    domainBox, bcs, dx, scomp, bccomp, ncomp, is_vel);
 
                 // Create transverse terms, s_{\i-\half\e_x}^{x|y}, etc.
 
                 MakeEdgeScalTransverse(
-                    mfi, slx_arr, srx_arr, sly_arr, sry_arr, slz_arr, srz_arr,
-                    scal_arr, divu.array(mfi), umac_arr, vmac_arr, wmac_arr,
-                    simhx_arr, simhy_arr, simhz_arr, simhxy_arr, simhxz_arr,
-                    simhyx_arr, simhyz_arr, simhzx_arr, simhzy_arr, domainBox,
-                    bcs, dx, scomp, bccomp, is_vel, is_conservative);
-
-                Array4<Real> const sedgex_arr = sedge[lev][0].array(mfi);
-                Array4<Real> const sedgey_arr = sedge[lev][1].array(mfi);
-                Array4<Real> const sedgez_arr = sedge[lev][2].array(mfi);
+                    mfi, slx_arr, srx_arr, sly_arr, sry_arr, slz_arr,
+                    srz_arr, scal_arr, divu_arr, umac_arr, vmac_arr,
+                    wmac_arr, simhx_arr, simhy_arr, simhz_arr, simhxy_arr,
+                    simhxz_arr, simhyx_arr, simhyz_arr, simhzx_arr,
+                    simhzy_arr, domainBox, bcs, dx, scomp, bccomp, ncomp,
+                    is_vel, is_conservative);
 
                 // Create sedgelx, etc.
 
                 MakeEdgeScalEdges(
-                    mfi, slx_arr, srx_arr, sly_arr, sry_arr, slz_arr, srz_arr,
-                    scal_arr, sedgex_arr, sedgey_arr, sedgez_arr,
-                    force[lev].array(mfi), umac_arr, vmac_arr, wmac_arr,
-                    Ipf.array(mfi), Imf.array(mfi), simhxy_arr, simhxz_arr,
-                    simhyx_arr, simhyz_arr, simhzx_arr, simhzy_arr, domainBox,
-                    bcs, dx, scomp, bccomp, is_vel, is_conservative);
-            }  // end MFIter loop
-        }      // end loop over components
+                    mfi, slx_arr, srx_arr, sly_arr, sry_arr, slz_arr,
+                    srz_arr, scal_arr, sedgex_arr, sedgey_arr, sedgez_arr,
+                    force_arr, umac_arr, vmac_arr, wmac_arr, Ipf_arr,
+                    Imf_arr, simhxy_arr, simhxz_arr, simhyx_arr, simhyz_arr,
+                    simhzx_arr, simhzy_arr, domainBox, bcs, dx, scomp,
+                    bccomp, ncomp, is_vel, is_conservative);
 #endif
-    }  // end loop over levels
+            }  // end loop over batches
+        }      // end MFIter loop
+    }          // end loop over levels
 
     // We use edge_restriction for the output velocity if is_vel == 1
     // we do not use edge_restriction for scalars because instead we will use
@@ -311,7 +276,7 @@ void Maestro::MakeEdgeScalPredictor(
     Array4<Real> const vmac, Array4<Real> const simhx, Array4<Real> const simhy,
     const Box& domainBox, const Vector<BCRec>& bcs,
     const amrex::GpuArray<Real, AMREX_SPACEDIM> dx, int comp, int bccomp,
-    bool is_vel) {
+    int ncomp, bool is_vel) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeEdgeScalPredictor()", MakeEdgeScalPredictor);
 
@@ -326,8 +291,10 @@ void Maestro::MakeEdgeScalPredictor(
     const Real dt2 = 0.5 * dt;
     const auto rel_eps_local = rel_eps;
 
-    // Get the index space of the valid region
-    const Box& obx = mfi.growntilebox(1);
+    // Get the index space of the valid region.  Grow the tile on every side
+    // (not just at the edges of the valid box) so each tile computes all of
+    // the interface states it needs.
+    const Box& obx = amrex::grow(mfi.tilebox(), 1);
     const Box& mxbx = amrex::growLo(obx, 0, -1);
     const Box& mybx = amrex::growLo(obx, 1, -1);
 
@@ -337,118 +304,134 @@ void Maestro::MakeEdgeScalPredictor(
     int bclo = bcs[bccomp].lo()[0];
     int bchi = bcs[bccomp].hi()[0];
     ParallelFor(mxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        if (ppm_type_local == 0) {
-            // make slx, srx with 1D extrapolation
-            slx(i, j, k) =
-                s(i - 1, j, k, comp) +
-                (0.5 - dt2 * umac(i, j, k) / hx) * Ip(i - 1, j, k, 0);
-            srx(i, j, k) = s(i, j, k, comp) -
-                           (0.5 + dt2 * umac(i, j, k) / hx) * Ip(i, j, k, 0);
-        } else if (ppm_type_local == 1 || ppm_type_local == 2) {
-            // make slx, srx with 1D extrapolation
-            slx(i, j, k) = Ip(i - 1, j, k, 0);
-            srx(i, j, k) = Im(i, j, k, 0);
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+            const int nd = AMREX_SPACEDIM * n;
+
+            if (ppm_type_local == 0) {
+                // make slx, srx with 1D extrapolation
+                slx(i, j, k, n) =
+                    s(i - 1, j, k, c) +
+                    (0.5 - dt2 * umac(i, j, k) / hx) * Ip(i - 1, j, k, nd);
+                srx(i, j, k, n) =
+                    s(i, j, k, c) -
+                    (0.5 + dt2 * umac(i, j, k) / hx) * Ip(i, j, k, nd);
+            } else if (ppm_type_local == 1 || ppm_type_local == 2) {
+                // make slx, srx with 1D extrapolation
+                slx(i, j, k, n) = Ip(i - 1, j, k, nd);
+                srx(i, j, k, n) = Im(i, j, k, nd);
+            }
 
-        // impose lo side bc's
-        if (i == domlo[0]) {
-            if (bclo == EXT_DIR) {
-                slx(i, j, k) = s(i - 1, j, k, comp);
-                srx(i, j, k) = s(i - 1, j, k, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 0) {
-                    srx(i, j, k) = amrex::min(srx(i, j, k), 0.0);
+            // impose lo side bc's
+            if (i == domlo[0]) {
+                if (bclo == EXT_DIR) {
+                    slx(i, j, k, n) = s(i - 1, j, k, c);
+                    srx(i, j, k, n) = s(i - 1, j, k, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 0) {
+                        srx(i, j, k, n) = amrex::min(srx(i, j, k, n), 0.0);
+                    }
+                    slx(i, j, k, n) = srx(i, j, k, n);
+                } else if (bclo == REFLECT_EVEN) {
+                    slx(i, j, k, n) = srx(i, j, k, n);
+                } else if (bclo == REFLECT_ODD) {
+                    slx(i, j, k, n) = 0.0;
+                    srx(i, j, k, n) = 0.0;
                 }
-                slx(i, j, k) = srx(i, j, k);
-            } else if (bclo == REFLECT_EVEN) {
-                slx(i, j, k) = srx(i, j, k);
-            } else if (bclo == REFLECT_ODD) {
-                slx(i, j, k) = 0.0;
-                srx(i, j, k) = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (i == domhi[0] + 1) {
-            if (bchi == EXT_DIR) {
-                slx(i, j, k) = s(i, j, k, comp);
-                srx(i, j, k) = s(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 0) {
-                    slx(i, j, k) = amrex::max(slx(i, j, k), 0.0);
+                // impose hi side bc's
+            } else if (i == domhi[0] + 1) {
+                if (bchi == EXT_DIR) {
+                    slx(i, j, k, n) = s(i, j, k, c);
+                    srx(i, j, k, n) = s(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 0) {
+                        slx(i, j, k, n) = amrex::max(slx(i, j, k, n), 0.0);
+                    }
+                    srx(i, j, k, n) = slx(i, j, k, n);
+                } else if (bchi == REFLECT_EVEN) {
+                    srx(i, j, k, n) = slx(i, j, k, n);
+                } else if (bchi == REFLECT_ODD) {
+                    slx(i, j, k, n) = 0.0;
+                    srx(i, j, k, n) = 0.0;
                 }
-                srx(i, j, k) = slx(i, j, k);
-            } else if (bchi == REFLECT_EVEN) {
-                srx(i, j, k) = slx(i, j, k);
-            } else if (bchi == REFLECT_ODD) {
-                slx(i, j, k) = 0.0;
-                srx(i, j, k) = 0.0;
             }
-        }
 
-        // make simhx by solving Riemann problem
-        simhx(i, j, k) = (umac(i, j, k) > 0.0) ? slx(i, j, k) : srx(i, j, k);
-        simhx(i, j, k) = (amrex::Math::abs(umac(i, j, k)) > rel_eps_local)
-                             ? simhx(i, j, k)
-                             : 0.5 * (slx(i, j, k) + srx(i, j, k));
+            // make simhx by solving Riemann problem
+            simhx(i, j, k, n) =
+                (umac(i, j, k) > 0.0) ? slx(i, j, k, n) : srx(i, j, k, n);
+            simhx(i, j, k, n) =
+                (amrex::Math::abs(umac(i, j, k)) > rel_eps_local)
+                    ? simhx(i, j, k, n)
+                    : 0.5 * (slx(i, j, k, n) + srx(i, j, k, n));
+        }
     });
 
     // loop over appropriate y-faces
     bclo = bcs[bccomp].lo()[1];
     bchi = bcs[bccomp].hi()[1];
     ParallelFor(mybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        if (ppm_type_local == 0) {
-            // make sly, sry with 1D extrapolation
-            sly(i, j, k) =
-                s(i, j - 1, k, comp) +
-                (0.5 - dt2 * vmac(i, j, k) / hy) * Im(i, j - 1, k, 0);
-            sry(i, j, k) = s(i, j, k, comp) -
-                           (0.5 + dt2 * vmac(i, j, k) / hy) * Im(i, j, k, 0);
-        } else if (ppm_type_local == 1 || ppm_type_local == 2) {
-            // make sly, sry with 1D extrapolation
-            sly(i, j, k) = Ip(i, j - 1, k, 1);
-            sry(i, j, k) = Im(i, j, k, 1);
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+            const int nd = AMREX_SPACEDIM * n;
+
+            if (ppm_type_local == 0) {
+                // make sly, sry with 1D extrapolation
+                sly(i, j, k, n) =
+                    s(i, j - 1, k, c) +
+                    (0.5 - dt2 * vmac(i, j, k) / hy) * Im(i, j - 1, k, nd);
+                sry(i, j, k, n) =
+                    s(i, j, k, c) -
+                    (0.5 + dt2 * vmac(i, j, k) / hy) * Im(i, j, k, nd);
+            } else if (ppm_type_local == 1 || ppm_type_local == 2) {
+                // make sly, sry with 1D extrapolation
+                sly(i, j, k, n) = Ip(i, j - 1, k, nd + 1);
+                sry(i, j, k, n) = Im(i, j, k, nd + 1);
+            }
 
-        // impose lo side bc's
-        if (j == domlo[1]) {
-            if (bclo == EXT_DIR) {
-                sly(i, j, k) = s(i, j - 1, k, comp);
-                sry(i, j, k) = s(i, j - 1, k, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 1) {
-                    sry(i, j, k) = amrex::min(sry(i, j, k), 0.0);
+            // impose lo side bc's
+            if (j == domlo[1]) {
+                if (bclo == EXT_DIR) {
+                    sly(i, j, k, n) = s(i, j - 1, k, c);
+                    sry(i, j, k, n) = s(i, j - 1, k, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 1) {
+                        sry(i, j, k, n) = amrex::min(sry(i, j, k, n), 0.0);
+                    }
+                    sly(i, j, k, n) = sry(i, j, k, n);
+                } else if (bclo == REFLECT_EVEN) {
+                    sly(i, j, k, n) = sry(i, j, k, n);
+                } else if (bclo == REFLECT_ODD) {
+                    sly(i, j, k, n) = 0.0;
+                    sry(i, j, k, n) = 0.0;
                 }
-                sly(i, j, k) = sry(i, j, k);
-            } else if (bclo == REFLECT_EVEN) {
-                sly(i, j, k) = sry(i, j, k);
-            } else if (bclo == REFLECT_ODD) {
-                sly(i, j, k) = 0.0;
-                sry(i, j, k) = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (j == domhi[1] + 1) {
-            if (bchi == EXT_DIR) {
-                sly(i, j, k) = s(i, j, k, comp);
-                sry(i, j, k) = s(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 1) {
-                    sly(i, j, k) = amrex::max(sly(i, j, k), 0.0);
+                // impose hi side bc's
+            } else if (j == domhi[1] + 1) {
+                if (bchi == EXT_DIR) {
+                    sly(i, j, k, n) = s(i, j, k, c);
+                    sry(i, j, k, n) = s(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 1) {
+                        sly(i, j, k, n) = amrex::max(sly(i, j, k, n), 0.0);
+                    }
+                    sry(i, j, k, n) = sly(i, j, k, n);
+                } else if (bchi == REFLECT_EVEN) {
+                    sry(i, j, k, n) = sly(i, j, k, n);
+                } else if (bchi == REFLECT_ODD) {
+                    sly(i, j, k, n) = 0.0;
+                    sry(i, j, k, n) = 0.0;
                 }
-                sry(i, j, k) = sly(i, j, k);
-            } else if (bchi == REFLECT_EVEN) {
-                sry(i, j, k) = sly(i, j, k);
-            } else if (bchi == REFLECT_ODD) {
-                sly(i, j, k) = 0.0;
-                sry(i, j, k) = 0.0;
             }
-        }
 
-        // make simhy by solving Riemann problem
-        simhy(i, j, k) = (vmac(i, j, k) > 0.0) ? sly(i, j, k) : sry(i, j, k);
-        simhy(i, j, k) = (amrex::Math::abs(vmac(i, j, k)) > rel_eps_local)
-                             ? simhy(i, j, k)
-                             : 0.5 * (sly(i, j, k) + sry(i, j, k));
+            // make simhy by solving Riemann problem
+            simhy(i, j, k, n) =
+                (vmac(i, j, k) > 0.0) ? sly(i, j, k, n) : sry(i, j, k, n);
+            simhy(i, j, k, n) =
+                (amrex::Math::abs(vmac(i, j, k)) > rel_eps_local)
+                    ? simhy(i, j, k, n)
+                    : 0.5 * (sly(i, j, k, n) + sry(i, j, k, n));
+        }
     });
 }
 
@@ -460,7 +443,7 @@ void Maestro::MakeEdgeScalEdges(
     Array4<Real> const Ipf, Array4<Real> const Imf, Array4<Real> const simhx,
     Array4<Real> const simhy, const Box& domainBox, const Vector<BCRec>& bcs,
     const amrex::GpuArray<Real, AMREX_SPACEDIM> dx, int comp, int bccomp,
-    const bool is_vel, const bool is_conservative) {
+    int ncomp, const bool is_vel, const bool is_conservative) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeEdgeScalEdges()", MakeEdgeScalEdges);
 
@@ -488,77 +471,85 @@ void Maestro::MakeEdgeScalEdges(
     int bclo = bcs[bccomp].lo()[0];
     int bchi = bcs[bccomp].hi()[0];
     ParallelFor(xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        Real sedgelx = 0.0;
-        Real sedgerx = 0.0;
-
-        Real fl = (ppm_trace_forces_local == 0) ? force(i - 1, j, k, comp)
-                                                : Ipf(i - 1, j, k, 0);
-        Real fr = (ppm_trace_forces_local == 0) ? force(i, j, k, comp)
-                                                : Imf(i, j, k, 0);
-
-        if (is_conservative) {
-            sedgelx =
-                slx(i, j, k) -
-                (dt2 / hy) * (simhy(i - 1, j + 1, k) * vmac(i - 1, j + 1, k) -
-                              simhy(i - 1, j, k) * vmac(i - 1, j, k)) -
-                (dt2 / hx) * s(i - 1, j, k, comp) *
-                    (umac(i, j, k) - umac(i - 1, j, k)) +
-                dt2 * fl;
-            sedgerx = srx(i, j, k) -
-                      (dt2 / hy) * (simhy(i, j + 1, k) * vmac(i, j + 1, k) -
-                                    simhy(i, j, k) * vmac(i, j, k)) -
-                      (dt2 / hx) * s(i, j, k, comp) *
-                          (umac(i + 1, j, k) - umac(i, j, k)) +
-                      dt2 * fr;
-        } else {
-            sedgelx = slx(i, j, k) -
-                      (dt4 / hy) * (vmac(i - 1, j + 1, k) + vmac(i - 1, j, k)) *
-                          (simhy(i - 1, j + 1, k) - simhy(i - 1, j, k)) +
-                      dt2 * fl;
-            sedgerx = srx(i, j, k) -
-                      (dt4 / hy) * (vmac(i, j + 1, k) + vmac(i, j, k)) *
-                          (simhy(i, j + 1, k) - simhy(i, j, k)) +
-                      dt2 * fr;
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+            const int nd = AMREX_SPACEDIM * n;
+
+            Real sedgelx = 0.0;
+            Real sedgerx = 0.0;
+
+            Real fl = (ppm_trace_forces_local == 0) ? force(i - 1, j, k, c)
+                                                    : Ipf(i - 1, j, k, nd);
+            Real fr = (ppm_trace_forces_local == 0) ? force(i, j, k, c)
+                                                    : Imf(i, j, k, nd);
+
+            if (is_conservative) {
+                sedgelx = slx(i, j, k, n) -
+                          (dt2 / hy) *
+                              (simhy(i - 1, j + 1, k, n) *
+                                   vmac(i - 1, j + 1, k) -
+                               simhy(i - 1, j, k, n) * vmac(i - 1, j, k)) -
+                          (dt2 / hx) * s(i - 1, j, k, c) *
+                              (umac(i, j, k) - umac(i - 1, j, k)) +
+                          dt2 * fl;
+                sedgerx = srx(i, j, k, n) -
+                          (dt2 / hy) *
+                              (simhy(i, j + 1, k, n) * vmac(i, j + 1, k) -
+                               simhy(i, j, k, n) * vmac(i, j, k)) -
+                          (dt2 / hx) * s(i, j, k, c) *
+                              (umac(i + 1, j, k) - umac(i, j, k)) +
+                          dt2 * fr;
+            } else {
+                sedgelx =
+                    slx(i, j, k, n) -
+                    (dt4 / hy) * (vmac(i - 1, j + 1, k) + vmac(i - 1, j, k)) *
+                        (simhy(i - 1, j + 1, k, n) - simhy(i - 1, j, k, n)) +
+                    dt2 * fl;
+                sedgerx = srx(i, j, k, n) -
+                          (dt4 / hy) * (vmac(i, j + 1, k) + vmac(i, j, k)) *
+                              (simhy(i, j + 1, k, n) - simhy(i, j, k, n)) +
+                          dt2 * fr;
+            }
 
-        // make sedgex by solving Riemann problem
-        // boundary conditions enforced outside of i,j loop
-        sedgex(i, j, k, comp) = (umac(i, j, k) > 0.0) ? sedgelx : sedgerx;
-        sedgex(i, j, k, comp) =
-            (amrex::Math::abs(umac(i, j, k)) > rel_eps_local)
-                ? sedgex(i, j, k, comp)
-                : 0.5 * (sedgelx + sedgerx);
-
-        // impose lo side bc's
-        if (i == domlo[0]) {
-            if (bclo == EXT_DIR) {
-                sedgex(i, j, k, comp) = s(i - 1, j, k, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 0) {
-                    sedgex(i, j, k, comp) = amrex::min(sedgerx, 0.0);
-                } else {
-                    sedgex(i, j, k, comp) = sedgerx;
+            // make sedgex by solving Riemann problem
+            // boundary conditions enforced outside of i,j loop
+            sedgex(i, j, k, c) = (umac(i, j, k) > 0.0) ? sedgelx : sedgerx;
+            sedgex(i, j, k, c) =
+                (amrex::Math::abs(umac(i, j, k)) > rel_eps_local)
+                    ? sedgex(i, j, k, c)
+                    : 0.5 * (sedgelx + sedgerx);
+
+            // impose lo side bc's
+            if (i == domlo[0]) {
+                if (bclo == EXT_DIR) {
+                    sedgex(i, j, k, c) = s(i - 1, j, k, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 0) {
+                        sedgex(i, j, k, c) = amrex::min(sedgerx, 0.0);
+                    } else {
+                        sedgex(i, j, k, c) = sedgerx;
+                    }
+                } else if (bclo == REFLECT_EVEN) {
+                    sedgex(i, j, k, c) = sedgerx;
+                } else if (bclo == REFLECT_ODD) {
+                    sedgex(i, j, k, c) = 0.0;
                 }
-            } else if (bclo == REFLECT_EVEN) {
-                sedgex(i, j, k, comp) = sedgerx;
-            } else if (bclo == REFLECT_ODD) {
-                sedgex(i, j, k, comp) = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (i == domhi[0] + 1) {
-            if (bchi == EXT_DIR) {
-                sedgex(i, j, k, comp) = s(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 0) {
-                    sedgex(i, j, k, comp) = amrex::max(sedgelx, 0.0);
-                } else {
-                    sedgex(i, j, k, comp) = sedgelx;
+                // impose hi side bc's
+            } else if (i == domhi[0] + 1) {
+                if (bchi == EXT_DIR) {
+                    sedgex(i, j, k, c) = s(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 0) {
+                        sedgex(i, j, k, c) = amrex::max(sedgelx, 0.0);
+                    } else {
+                        sedgex(i, j, k, c) = sedgelx;
+                    }
+                } else if (bchi == REFLECT_EVEN) {
+                    sedgex(i, j, k, c) = sedgelx;
+                } else if (bchi == REFLECT_ODD) {
+                    sedgex(i, j, k, c) = 0.0;
                 }
-            } else if (bchi == REFLECT_EVEN) {
-                sedgex(i, j, k, comp) = sedgelx;
-            } else if (bchi == REFLECT_ODD) {
-                sedgex(i, j, k, comp) = 0.0;
             }
         }
     });
@@ -567,78 +558,86 @@ void Maestro::MakeEdgeScalEdges(
     bclo = bcs[bccomp].lo()[1];
     bchi = bcs[bccomp].hi()[1];
     ParallelFor(ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        Real sedgely = 0.0;
-        Real sedgery = 0.0;
-
-        Real fl = (ppm_trace_forces_local == 0) ? force(i, j - 1, k, comp)
-                                                : Ipf(i, j - 1, k, 1);
-        Real fr = (ppm_trace_forces_local == 0) ? force(i, j, k, comp)
-                                                : Imf(i, j, k, 1);
-
-        // make sedgely, sedgery
-        if (is_conservative) {
-            sedgely =
-                sly(i, j, k) -
-                (dt2 / hx) * (simhx(i + 1, j - 1, k) * umac(i + 1, j - 1, k) -
-                              simhx(i, j - 1, k) * umac(i, j - 1, k)) -
-                (dt2 / hy) * s(i, j - 1, k, comp) *
-                    (vmac(i, j, k) - vmac(i, j - 1, k)) +
-                dt2 * fl;
-            sedgery = sry(i, j, k) -
-                      (dt2 / hx) * (simhx(i + 1, j, k) * umac(i + 1, j, k) -
-                                    simhx(i, j, k) * umac(i, j, k)) -
-                      (dt2 / hy) * s(i, j, k, comp) *
-                          (vmac(i, j + 1, k) - vmac(i, j, k)) +
-                      dt2 * fr;
-        } else {
-            sedgely = sly(i, j, k) -
-                      (dt4 / hx) * (umac(i + 1, j - 1, k) + umac(i, j - 1, k)) *
-                          (simhx(i + 1, j - 1, k) - simhx(i, j - 1, k)) +
-                      dt2 * fl;
-            sedgery = sry(i, j, k) -
-                      (dt4 / hx) * (umac(i + 1, j, k) + umac(i, j, k)) *
-                          (simhx(i + 1, j, k) - simhx(i, j, k)) +
-                      dt2 * fr;
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+            const int nd = AMREX_SPACEDIM * n;
+
+            Real sedgely = 0.0;
+            Real sedgery = 0.0;
+
+            Real fl = (ppm_trace_forces_local == 0) ? force(i, j - 1, k, c)
+                                                    : Ipf(i, j - 1, k, nd + 1);
+            Real fr = (ppm_trace_forces_local == 0) ? force(i, j, k, c)
+                                                    : Imf(i, j, k, nd + 1);
+
+            // make sedgely, sedgery
+            if (is_conservative) {
+                sedgely = sly(i, j, k, n) -
+                          (dt2 / hx) *
+                              (simhx(i + 1, j - 1, k, n) *
+                                   umac(i + 1, j - 1, k) -
+                               simhx(i, j - 1, k, n) * umac(i, j - 1, k)) -
+                          (dt2 / hy) * s(i, j - 1, k, c) *
+                              (vmac(i, j, k) - vmac(i, j - 1, k)) +
+                          dt2 * fl;
+                sedgery = sry(i, j, k, n) -
+                          (dt2 / hx) *
+                              (simhx(i + 1, j, k, n) * umac(i + 1, j, k) -
+                               simhx(i, j, k, n) * umac(i, j, k)) -
+                          (dt2 / hy) * s(i, j, k, c) *
+                              (vmac(i, j + 1, k) - vmac(i, j, k)) +
+                          dt2 * fr;
+            } else {
+                sedgely =
+                    sly(i, j, k, n) -
+                    (dt4 / hx) * (umac(i + 1, j - 1, k) + umac(i, j - 1, k)) *
+                        (simhx(i + 1, j - 1, k, n) - simhx(i, j - 1, k, n)) +
+                    dt2 * fl;
+                sedgery = sry(i, j, k, n) -
+                          (dt4 / hx) * (umac(i + 1, j, k) + umac(i, j, k)) *
+                              (simhx(i + 1, j, k, n) - simhx(i, j, k, n)) +
+                          dt2 * fr;
+            }
 
-        // make sedgey by solving Riemann problem
-        // boundary conditions enforced outside of i,j loop
-        sedgey(i, j, k, comp) = (vmac(i, j, k) > 0.0) ? sedgely : sedgery;
-        sedgey(i, j, k, comp) =
-            (amrex::Math::abs(vmac(i, j, k)) > rel_eps_local)
-                ? sedgey(i, j, k, comp)
-                : 0.5 * (sedgely + sedgery);
-
-        // impose lo side bc's
-        if (j == domlo[1]) {
-            if (bclo == EXT_DIR) {
-                sedgey(i, j, k, comp) = s(i, j - 1, k, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 1) {
-                    sedgey(i, j, k, comp) = amrex::min(sedgery, 0.0);
-                } else {
-                    sedgey(i, j, k, comp) = sedgery;
+            // make sedgey by solving Riemann problem
+            // boundary conditions enforced outside of i,j loop
+            sedgey(i, j, k, c) = (vmac(i, j, k) > 0.0) ? sedgely : sedgery;
+            sedgey(i, j, k, c) =
+                (amrex::Math::abs(vmac(i, j, k)) > rel_eps_local)
+                    ? sedgey(i, j, k, c)
+                    : 0.5 * (sedgely + sedgery);
+
+            // impose lo side bc's
+            if (j == domlo[1]) {
+                if (bclo == EXT_DIR) {
+                    sedgey(i, j, k, c) = s(i, j - 1, k, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 1) {
+                        sedgey(i, j, k, c) = amrex::min(sedgery, 0.0);
+                    } else {
+                        sedgey(i, j, k, c) = sedgery;
+                    }
+                } else if (bclo == REFLECT_EVEN) {
+                    sedgey(i, j, k, c) = sedgery;
+                } else if (bclo == REFLECT_ODD) {
+                    sedgey(i, j, k, c) = 0.0;
                 }
-            } else if (bclo == REFLECT_EVEN) {
-                sedgey(i, j, k, comp) = sedgery;
-            } else if (bclo == REFLECT_ODD) {
-                sedgey(i, j, k, comp) = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (j == domhi[1] + 1) {
-            if (bchi == EXT_DIR) {
-                sedgey(i, j, k, comp) = s(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 1) {
-                    sedgey(i, j, k, comp) = amrex::max(sedgely, 0.0);
-                } else {
-                    sedgey(i, j, k, comp) = sedgely;
+                // impose hi side bc's
+            } else if (j == domhi[1] + 1) {
+                if (bchi == EXT_DIR) {
+                    sedgey(i, j, k, c) = s(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 1) {
+                        sedgey(i, j, k, c) = amrex::max(sedgely, 0.0);
+                    } else {
+                        sedgey(i, j, k, c) = sedgely;
+                    }
+                } else if (bchi == REFLECT_EVEN) {
+                    sedgey(i, j, k, c) = sedgely;
+                } else if (bchi == REFLECT_ODD) {
+                    sedgey(i, j, k, c) = 0.0;
                 }
-            } else if (bchi == REFLECT_EVEN) {
-                sedgey(i, j, k, comp) = sedgely;
-            } else if (bchi == REFLECT_ODD) {
-                sedgey(i, j, k, comp) = 0.0;
             }
         }
     });
@@ -668,7 +667,7 @@ void Maestro::MakeEdgeScalPredictor(
     Array4<Real> const vmac, Array4<Real> const wmac, Array4<Real> const simhx,
     Array4<Real> const simhy, Array4<Real> const simhz, const Box& domainBox,
     const Vector<BCRec>& bcs, const amrex::GpuArray<Real, AMREX_SPACEDIM> dx,
-    int comp, int bccomp, bool is_vel) {
+    int comp, int bccomp, int ncomp, bool is_vel) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeEdgeScalPredictor()", MakeEdgeScalPredictor);
 
@@ -695,171 +694,189 @@ void Maestro::MakeEdgeScalPredictor(
     int bclo = bcs[bccomp].lo()[0];
     int bchi = bcs[bccomp].hi()[0];
     ParallelFor(mxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        if (ppm_type_local == 0) {
-            slx(i, j, k) =
-                scal(i - 1, j, k, comp) +
-                0.5 * (1.0 - dt_loc * umac(i, j, k) / hx) * Ip(i - 1, j, k, 0);
-            srx(i, j, k) =
-                scal(i, j, k, comp) -
-                0.5 * (1.0 + dt_loc * umac(i, j, k) / hx) * Ip(i, j, k, 0);
-        } else if (ppm_type_local == 1 || ppm_type_local == 2) {
-            slx(i, j, k) = Ip(i - 1, j, k, 0);
-            srx(i, j, k) = Im(i, j, k, 0);
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+            const int nd = AMREX_SPACEDIM * n;
+
+            if (ppm_type_local == 0) {
+                slx(i, j, k, n) = scal(i - 1, j, k, c) +
+                                  0.5 * (1.0 - dt_loc * umac(i, j, k) / hx) *
+                                      Ip(i - 1, j, k, nd);
+                srx(i, j, k, n) = scal(i, j, k, c) -
+                                  0.5 * (1.0 + dt_loc * umac(i, j, k) / hx) *
+                                      Ip(i, j, k, nd);
+            } else if (ppm_type_local == 1 || ppm_type_local == 2) {
+                slx(i, j, k, n) = Ip(i - 1, j, k, nd);
+                srx(i, j, k, n) = Im(i, j, k, nd);
+            }
 
-        // impose lo side bc's
-        if (i == domlo[0]) {
-            if (bclo == EXT_DIR) {
-                slx(i, j, k) = scal(i - 1, j, k, comp);
-                srx(i, j, k) = scal(i - 1, j, k, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 0) {
-                    srx(i, j, k) = amrex::min(srx(i, j, k), 0.0);
+            // impose lo side bc's
+            if (i == domlo[0]) {
+                if (bclo == EXT_DIR) {
+                    slx(i, j, k, n) = scal(i - 1, j, k, c);
+                    srx(i, j, k, n) = scal(i - 1, j, k, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 0) {
+                        srx(i, j, k, n) = amrex::min(srx(i, j, k, n), 0.0);
+                    }
+                    slx(i, j, k, n) = srx(i, j, k, n);
+                } else if (bclo == REFLECT_EVEN) {
+                    slx(i, j, k, n) = srx(i, j, k, n);
+                } else if (bclo == REFLECT_ODD) {
+                    slx(i, j, k, n) = 0.0;
+                    srx(i, j, k, n) = 0.0;
                 }
-                slx(i, j, k) = srx(i, j, k);
-            } else if (bclo == REFLECT_EVEN) {
-                slx(i, j, k) = srx(i, j, k);
-            } else if (bclo == REFLECT_ODD) {
-                slx(i, j, k) = 0.0;
-                srx(i, j, k) = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (i == domhi[0] + 1) {
-            if (bchi == EXT_DIR) {
-                slx(i, j, k) = scal(i, j, k, comp);
-                srx(i, j, k) = scal(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 0) {
-                    slx(i, j, k) = amrex::max(slx(i, j, k), 0.0);
+                // impose hi side bc's
+            } else if (i == domhi[0] + 1) {
+                if (bchi == EXT_DIR) {
+                    slx(i, j, k, n) = scal(i, j, k, c);
+                    srx(i, j, k, n) = scal(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 0) {
+                        slx(i, j, k, n) = amrex::max(slx(i, j, k, n), 0.0);
+                    }
+                    srx(i, j, k, n) = slx(i, j, k, n);
+                } else if (bchi == REFLECT_EVEN) {
+                    srx(i, j, k, n) = slx(i, j, k, n);
+                } else if (bchi == REFLECT_ODD) {
+                    slx(i, j, k, n) = 0.0;
+                    srx(i, j, k, n) = 0.0;
                 }
-                srx(i, j, k) = slx(i, j, k);
-            } else if (bchi == REFLECT_EVEN) {
-                srx(i, j, k) = slx(i, j, k);
-            } else if (bchi == REFLECT_ODD) {
-                slx(i, j, k) = 0.0;
-                srx(i, j, k) = 0.0;
             }
-        }
 
-        // make simhx by solving Riemann problem
-        simhx(i, j, k) = (umac(i, j, k) > 0.0) ? slx(i, j, k) : srx(i, j, k);
-        simhx(i, j, k) = (amrex::Math::abs(umac(i, j, k)) > 0.0)
-                             ? simhx(i, j, k)
-                             : 0.5 * (slx(i, j, k) + srx(i, j, k));
+            // make simhx by solving Riemann problem
+            simhx(i, j, k, n) =
+                (umac(i, j, k) > 0.0) ? slx(i, j, k, n) : srx(i, j, k, n);
+            simhx(i, j, k, n) = (amrex::Math::abs(umac(i, j, k)) > 0.0)
+                                    ? simhx(i, j, k, n)
+                                    : 0.5 * (slx(i, j, k, n) + srx(i, j, k, n));
+        }
     });
 
     // loop over appropriate y-faces
     bclo = bcs[bccomp].lo()[1];
     bchi = bcs[bccomp].hi()[1];
     ParallelFor(mybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        if (ppm_type_local == 0) {
-            sly(i, j, k) =
-                scal(i, j - 1, k, comp) +
-                0.5 * (1.0 - dt_loc * vmac(i, j, k) / hy) * Im(i, j - 1, k, 0);
-            sry(i, j, k) =
-                scal(i, j, k, comp) -
-                0.5 * (1.0 + dt_loc * vmac(i, j, k) / hy) * Im(i, j, k, 0);
-        } else if (ppm_type_local == 1 || ppm_type_local == 2) {
-            sly(i, j, k) = Ip(i, j - 1, k, 1);
-            sry(i, j, k) = Im(i, j, k, 1);
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+            const int nd = AMREX_SPACEDIM * n;
+
+            if (ppm_type_local == 0) {
+                sly(i, j, k, n) = scal(i, j - 1, k, c) +
+                                  0.5 * (1.0 - dt_loc * vmac(i, j, k) / hy) *
+                                      Im(i, j - 1, k, nd);
+                sry(i, j, k, n) = scal(i, j, k, c) -
+                                  0.5 * (1.0 + dt_loc * vmac(i, j, k) / hy) *
+                                      Im(i, j, k, nd);
+            } else if (ppm_type_local == 1 || ppm_type_local == 2) {
+                sly(i, j, k, n) = Ip(i, j - 1, k, nd + 1);
+                sry(i, j, k, n) = Im(i, j, k, nd + 1);
+            }
 
-        // impose lo side bc's
-        if (j == domlo[1]) {
-            if (bclo == EXT_DIR) {
-                sly(i, j, k) = scal(i, j - 1, k, comp);
-                sry(i, j, k) = scal(i, j - 1, k, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 1) {
-                    sry(i, j, k) = amrex::min(sry(i, j, k), 0.0);
+            // impose lo side bc's
+            if (j == domlo[1]) {
+                if (bclo == EXT_DIR) {
+                    sly(i, j, k, n) = scal(i, j - 1, k, c);
+                    sry(i, j, k, n) = scal(i, j - 1, k, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 1) {
+                        sry(i, j, k, n) = amrex::min(sry(i, j, k, n), 0.0);
+                    }
+                    sly(i, j, k, n) = sry(i, j, k, n);
+                } else if (bclo == REFLECT_EVEN) {
+                    sly(i, j, k, n) = sry(i, j, k, n);
+                } else if (bclo == REFLECT_ODD) {
+                    sly(i, j, k, n) = 0.0;
+                    sry(i, j, k, n) = 0.0;
                 }
-                sly(i, j, k) = sry(i, j, k);
-            } else if (bclo == REFLECT_EVEN) {
-                sly(i, j, k) = sry(i, j, k);
-            } else if (bclo == REFLECT_ODD) {
-                sly(i, j, k) = 0.0;
-                sry(i, j, k) = 0.0;
-            }
-            // impose hi side bc's
-        } else if (j == domhi[1] + 1) {
-            if (bchi == EXT_DIR) {
-                sly(i, j, k) = scal(i, j, k, comp);
-                sry(i, j, k) = scal(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 1) {
-                    sly(i, j, k) = amrex::max(sly(i, j, k), 0.0);
+                // impose hi side bc's
+            } else if (j == domhi[1] + 1) {
+                if (bchi == EXT_DIR) {
+                    sly(i, j, k, n) = scal(i, j, k, c);
+                    sry(i, j, k, n) = scal(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 1) {
+                        sly(i, j, k, n) = amrex::max(sly(i, j, k, n), 0.0);
+                    }
+                    sry(i, j, k, n) = sly(i, j, k, n);
+                } else if (bchi == REFLECT_EVEN) {
+                    sry(i, j, k, n) = sly(i, j, k, n);
+                } else if (bchi == REFLECT_ODD) {
+                    sly(i, j, k, n) = 0.0;
+                    sry(i, j, k, n) = 0.0;
                 }
-                sry(i, j, k) = sly(i, j, k);
-            } else if (bchi == REFLECT_EVEN) {
-                sry(i, j, k) = sly(i, j, k);
-            } else if (bchi == REFLECT_ODD) {
-                sly(i, j, k) = 0.0;
-                sry(i, j, k) = 0.0;
             }
-        }
 
-        // make simhy by solving Riemann problem
-        simhy(i, j, k) = (vmac(i, j, k) > 0.0) ? sly(i, j, k) : sry(i, j, k);
-        simhy(i, j, k) = (amrex::Math::abs(vmac(i, j, k)) > 0.0)
-                             ? simhy(i, j, k)
-                             : 0.5 * (sly(i, j, k) + sry(i, j, k));
+            // make simhy by solving Riemann problem
+            simhy(i, j, k, n) =
+                (vmac(i, j, k) > 0.0) ? sly(i, j, k, n) : sry(i, j, k, n);
+            simhy(i, j, k, n) = (amrex::Math::abs(vmac(i, j, k)) > 0.0)
+                                    ? simhy(i, j, k, n)
+                                    : 0.5 * (sly(i, j, k, n) + sry(i, j, k, n));
+        }
     });
 
     // loop over appropriate z-faces
     bclo = bcs[bccomp].lo()[2];
     bchi = bcs[bccomp].hi()[2];
     ParallelFor(mzbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        if (ppm_type_local == 0) {
-            slz(i, j, k) =
-                scal(i, j, k - 1, comp) +
-                0.5 * (1.0 - dt_loc * wmac(i, j, k) / hz) * slopez(i, j, k - 1);
-            srz(i, j, k) =
-                scal(i, j, k, comp) -
-                0.5 * (1.0 + dt_loc * wmac(i, j, k) / hz) * slopez(i, j, k);
-        } else if (ppm_type_local == 1 || ppm_type_local == 2) {
-            slz(i, j, k) = Ip(i, j, k - 1, 2);
-            srz(i, j, k) = Im(i, j, k, 2);
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+            const int nd = AMREX_SPACEDIM * n;
+
+            if (ppm_type_local == 0) {
+                slz(i, j, k, n) = scal(i, j, k - 1, c) +
+                                  0.5 * (1.0 - dt_loc * wmac(i, j, k) / hz) *
+                                      slopez(i, j, k - 1, n);
+                srz(i, j, k, n) = scal(i, j, k, c) -
+                                  0.5 * (1.0 + dt_loc * wmac(i, j, k) / hz) *
+                                      slopez(i, j, k, n);
+            } else if (ppm_type_local == 1 || ppm_type_local == 2) {
+                slz(i, j, k, n) = Ip(i, j, k - 1, nd + 2);
+                srz(i, j, k, n) = Im(i, j, k, nd + 2);
+            }
 
-        // impose lo side bc's
-        if (k == domlo[2]) {
-            if (bclo == EXT_DIR) {
-                slz(i, j, k) = scal(i, j, k - 1, comp);
-                srz(i, j, k) = scal(i, j, k - 1, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 2) {
-                    srz(i, j, k) = amrex::min(srz(i, j, k), 0.0);
+            // impose lo side bc's
+            if (k == domlo[2]) {
+                if (bclo == EXT_DIR) {
+                    slz(i, j, k, n) = scal(i, j, k - 1, c);
+                    srz(i, j, k, n) = scal(i, j, k - 1, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 2) {
+                        srz(i, j, k, n) = amrex::min(srz(i, j, k, n), 0.0);
+                    }
+                    slz(i, j, k, n) = srz(i, j, k, n);
+                } else if (bclo == REFLECT_EVEN) {
+                    slz(i, j, k, n) = srz(i, j, k, n);
+                } else if (bclo == REFLECT_ODD) {
+                    slz(i, j, k, n) = 0.0;
+                    srz(i, j, k, n) = 0.0;
                 }
-                slz(i, j, k) = srz(i, j, k);
-            } else if (bclo == REFLECT_EVEN) {
-                slz(i, j, k) = srz(i, j, k);
-            } else if (bclo == REFLECT_ODD) {
-                slz(i, j, k) = 0.0;
-                srz(i, j, k) = 0.0;
-            }
-            // impose hi side bc's
-        } else if (k == domhi[2] + 1) {
-            if (bchi == EXT_DIR) {
-                slz(i, j, k) = scal(i, j, k, comp);
-                srz(i, j, k) = scal(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 2) {
-                    slz(i, j, k) = amrex::max(slz(i, j, k), 0.0);
+                // impose hi side bc's
+            } else if (k == domhi[2] + 1) {
+                if (bchi == EXT_DIR) {
+                    slz(i, j, k, n) = scal(i, j, k, c);
+                    srz(i, j, k, n) = scal(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 2) {
+                        slz(i, j, k, n) = amrex::max(slz(i, j, k, n), 0.0);
+                    }
+                    srz(i, j, k, n) = slz(i, j, k, n);
+                } else if (bchi == REFLECT_EVEN) {
+                    srz(i, j, k, n) = slz(i, j, k, n);
+                } else if (bchi == REFLECT_ODD) {
+                    slz(i, j, k, n) = 0.0;
+                    srz(i, j, k, n) = 0.0;
                 }
-                srz(i, j, k) = slz(i, j, k);
-            } else if (bchi == REFLECT_EVEN) {
-                srz(i, j, k) = slz(i, j, k);
-            } else if (bchi == REFLECT_ODD) {
-                slz(i, j, k) = 0.0;
-                srz(i, j, k) = 0.0;
             }
-        }
 
-        simhz(i, j, k) = (wmac(i, j, k) > 0.0) ? slz(i, j, k) : srz(i, j, k);
-        simhz(i, j, k) = (amrex::Math::abs(wmac(i, j, k)) > 0.0)
-                             ? simhz(i, j, k)
-                             : 0.5 * (slz(i, j, k) + srz(i, j, k));
+            simhz(i, j, k, n) =
+                (wmac(i, j, k) > 0.0) ? slz(i, j, k, n) : srz(i, j, k, n);
+            simhz(i, j, k, n) = (amrex::Math::abs(wmac(i, j, k)) > 0.0)
+                                    ? simhz(i, j, k, n)
+                                    : 0.5 * (slz(i, j, k, n) + srz(i, j, k, n));
+        }
     });
 }
 
@@ -874,7 +891,7 @@ void Maestro::MakeEdgeScalTransverse(
     Array4<Real> const simhyz, Array4<Real> const simhzx,
     Array4<Real> const simhzy, const Box& domainBox, const Vector<BCRec>& bcs,
     const amrex::GpuArray<Real, AMREX_SPACEDIM> dx, int comp, int bccomp,
-    const bool is_vel, const bool is_conservative) {
+    int ncomp, const bool is_vel, const bool is_conservative) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeEdgeScalTransverse()", MakeEdgeScalTransverse);
 
@@ -901,75 +918,81 @@ void Maestro::MakeEdgeScalTransverse(
     int bclo = bcs[bccomp].lo()[0];
     int bchi = bcs[bccomp].hi()[0];
     ParallelFor(imhbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        Real slxy = 0.0;
-        Real srxy = 0.0;
-
-        // loop over appropriate xy faces
-        if (is_conservative) {
-            // make slxy, srxy by updating 1D extrapolation
-            slxy =
-                slx(i, j, k) -
-                (dt3 / hy) * (simhy(i - 1, j + 1, k) * vmac(i - 1, j + 1, k) -
-                              simhy(i - 1, j, k) * vmac(i - 1, j, k)) -
-                dt3 * scal(i - 1, j, k, comp) * divu(i - 1, j, k) +
-                (dt3 / hy) * scal(i - 1, j, k, comp) *
-                    (vmac(i - 1, j + 1, k) - vmac(i - 1, j, k));
-            srxy = srx(i, j, k) -
-                   (dt3 / hy) * (simhy(i, j + 1, k) * vmac(i, j + 1, k) -
-                                 simhy(i, j, k) * vmac(i, j, k)) -
-                   dt3 * scal(i, j, k, comp) * divu(i, j, k) +
-                   (dt3 / hy) * scal(i, j, k, comp) *
-                       (vmac(i, j + 1, k) - vmac(i, j, k));
-        } else {
-            // make slxy, srxy by updating 1D extrapolation
-            slxy = slx(i, j, k) -
-                   (dt6 / hy) * (vmac(i - 1, j + 1, k) + vmac(i - 1, j, k)) *
-                       (simhy(i - 1, j + 1, k) - simhy(i - 1, j, k));
-            srxy = srx(i, j, k) - (dt6 / hy) *
-                                      (vmac(i, j + 1, k) + vmac(i, j, k)) *
-                                      (simhy(i, j + 1, k) - simhy(i, j, k));
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+
+            Real slxy = 0.0;
+            Real srxy = 0.0;
+
+            // loop over appropriate xy faces
+            if (is_conservative) {
+                // make slxy, srxy by updating 1D extrapolation
+                slxy = slx(i, j, k, n) -
+                       (dt3 / hy) *
+                           (simhy(i - 1, j + 1, k, n) * vmac(i - 1, j + 1, k) -
+                            simhy(i - 1, j, k, n) * vmac(i - 1, j, k)) -
+                       dt3 * scal(i - 1, j, k, c) * divu(i - 1, j, k) +
+                       (dt3 / hy) * scal(i - 1, j, k, c) *
+                           (vmac(i - 1, j + 1, k) - vmac(i - 1, j, k));
+                srxy = srx(i, j, k, n) -
+                       (dt3 / hy) * (simhy(i, j + 1, k, n) * vmac(i, j + 1, k) -
+                                     simhy(i, j, k, n) * vmac(i, j, k)) -
+                       dt3 * scal(i, j, k, c) * divu(i, j, k) +
+                       (dt3 / hy) * scal(i, j, k, c) *
+                           (vmac(i, j + 1, k) - vmac(i, j, k));
+            } else {
+                // make slxy, srxy by updating 1D extrapolation
+                slxy = slx(i, j, k, n) -
+                       (dt6 / hy) *
+                           (vmac(i - 1, j + 1, k) + vmac(i - 1, j, k)) *
+                           (simhy(i - 1, j + 1, k, n) - simhy(i - 1, j, k, n));
+                srxy = srx(i, j, k, n) -
+                       (dt6 / hy) * (vmac(i, j + 1, k) + vmac(i, j, k)) *
+                           (simhy(i, j + 1, k, n) - simhy(i, j, k, n));
+            }
 
-        // impose lo side bc's
-        if (i == domlo[0]) {
-            if (bclo == EXT_DIR) {
-                slxy = scal(i - 1, j, k, comp);
-                srxy = scal(i - 1, j, k, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 0) {
-                    srxy = amrex::min(srxy, 0.0);
+            // impose lo side bc's
+            if (i == domlo[0]) {
+                if (bclo == EXT_DIR) {
+                    slxy = scal(i - 1, j, k, c);
+                    srxy = scal(i - 1, j, k, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 0) {
+                        srxy = amrex::min(srxy, 0.0);
+                    }
+                    slxy = srxy;
+                } else if (bclo == REFLECT_EVEN) {
+                    slxy = srxy;
+                } else if (bclo == REFLECT_ODD) {
+                    slxy = 0.0;
+                    srxy = 0.0;
                 }
-                slxy = srxy;
-            } else if (bclo == REFLECT_EVEN) {
-                slxy = srxy;
-            } else if (bclo == REFLECT_ODD) {
-                slxy = 0.0;
-                srxy = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (i == domhi[0] + 1) {
-            if (bchi == EXT_DIR) {
-                slxy = scal(i, j, k, comp);
-                srxy = scal(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 0) {
-                    slxy = amrex::max(slxy, 0.0);
+                // impose hi side bc's
+            } else if (i == domhi[0] + 1) {
+                if (bchi == EXT_DIR) {
+                    slxy = scal(i, j, k, c);
+                    srxy = scal(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 0) {
+                        slxy = amrex::max(slxy, 0.0);
+                    }
+                    srxy = slxy;
+                } else if (bchi == REFLECT_EVEN) {
+                    srxy = slxy;
+                } else if (bchi == REFLECT_ODD) {
+                    slxy = 0.0;
+                    srxy = 0.0;
                 }
-                srxy = slxy;
-            } else if (bchi == REFLECT_EVEN) {
-                srxy = slxy;
-            } else if (bchi == REFLECT_ODD) {
-                slxy = 0.0;
-                srxy = 0.0;
             }
-        }
 
-        // make simhxy by solving Riemann problem
-        simhxy(i, j, k) = (umac(i, j, k) > 0.0) ? slxy : srxy;
-        simhxy(i, j, k) = (amrex::Math::abs(umac(i, j, k)) > rel_eps_local)
-                              ? simhxy(i, j, k)
-                              : 0.5 * (slxy + srxy);
+            // make simhxy by solving Riemann problem
+            simhxy(i, j, k, n) = (umac(i, j, k) > 0.0) ? slxy : srxy;
+            simhxy(i, j, k, n) =
+                (amrex::Math::abs(umac(i, j, k)) > rel_eps_local)
+                    ? simhxy(i, j, k, n)
+                    : 0.5 * (slxy + srxy);
+        }
     });
 
     // simhxz
@@ -978,74 +1001,80 @@ void Maestro::MakeEdgeScalTransverse(
     // imhbox = mfi.grownnodaltilebox(0, amrex::IntVect(0,1,0));
 
     ParallelFor(imhbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        Real slxz = 0.0;
-        Real srxz = 0.0;
-        // loop over appropriate xz faces
-        if (is_conservative) {
-            // make slxz, srxz by updating 1D extrapolation
-            slxz =
-                slx(i, j, k) -
-                (dt3 / hz) * (simhz(i - 1, j, k + 1) * wmac(i - 1, j, k + 1) -
-                              simhz(i - 1, j, k) * wmac(i - 1, j, k)) -
-                dt3 * scal(i - 1, j, k, comp) * divu(i - 1, j, k) +
-                (dt3 / hz) * scal(i - 1, j, k, comp) *
-                    (wmac(i - 1, j, k + 1) - wmac(i - 1, j, k));
-            srxz = srx(i, j, k) -
-                   (dt3 / hz) * (simhz(i, j, k + 1) * wmac(i, j, k + 1) -
-                                 simhz(i, j, k) * wmac(i, j, k)) -
-                   dt3 * scal(i, j, k, comp) * divu(i, j, k) +
-                   (dt3 / hz) * scal(i, j, k, comp) *
-                       (wmac(i, j, k + 1) - wmac(i, j, k));
-        } else {
-            // make slxz, srxz by updating 1D extrapolation
-            slxz = slx(i, j, k) -
-                   (dt6 / hz) * (wmac(i - 1, j, k + 1) + wmac(i - 1, j, k)) *
-                       (simhz(i - 1, j, k + 1) - simhz(i - 1, j, k));
-            srxz = srx(i, j, k) - (dt6 / hz) *
-                                      (wmac(i, j, k + 1) + wmac(i, j, k)) *
-                                      (simhz(i, j, k + 1) - simhz(i, j, k));
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+
+            Real slxz = 0.0;
+            Real srxz = 0.0;
+            // loop over appropriate xz faces
+            if (is_conservative) {
+                // make slxz, srxz by updating 1D extrapolation
+                slxz = slx(i, j, k, n) -
+                       (dt3 / hz) *
+                           (simhz(i - 1, j, k + 1, n) * wmac(i - 1, j, k + 1) -
+                            simhz(i - 1, j, k, n) * wmac(i - 1, j, k)) -
+                       dt3 * scal(i - 1, j, k, c) * divu(i - 1, j, k) +
+                       (dt3 / hz) * scal(i - 1, j, k, c) *
+                           (wmac(i - 1, j, k + 1) - wmac(i - 1, j, k));
+                srxz = srx(i, j, k, n) -
+                       (dt3 / hz) * (simhz(i, j, k + 1, n) * wmac(i, j, k + 1) -
+                                     simhz(i, j, k, n) * wmac(i, j, k)) -
+                       dt3 * scal(i, j, k, c) * divu(i, j, k) +
+                       (dt3 / hz) * scal(i, j, k, c) *
+                           (wmac(i, j, k + 1) - wmac(i, j, k));
+            } else {
+                // make slxz, srxz by updating 1D extrapolation
+                slxz = slx(i, j, k, n) -
+                       (dt6 / hz) *
+                           (wmac(i - 1, j, k + 1) + wmac(i - 1, j, k)) *
+                           (simhz(i - 1, j, k + 1, n) - simhz(i - 1, j, k, n));
+                srxz = srx(i, j, k, n) -
+                       (dt6 / hz) * (wmac(i, j, k + 1) + wmac(i, j, k)) *
+                           (simhz(i, j, k + 1, n) - simhz(i, j, k, n));
+            }
 
-        // impose lo side bc's
-        if (i == domlo[0]) {
-            if (bclo == EXT_DIR) {
-                slxz = scal(i - 1, j, k, comp);
-                srxz = scal(i - 1, j, k, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 0) {
-                    srxz = amrex::min(srxz, 0.0);
+            // impose lo side bc's
+            if (i == domlo[0]) {
+                if (bclo == EXT_DIR) {
+                    slxz = scal(i - 1, j, k, c);
+                    srxz = scal(i - 1, j, k, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 0) {
+                        srxz = amrex::min(srxz, 0.0);
+                    }
+                    slxz = srxz;
+                } else if (bclo == REFLECT_EVEN) {
+                    slxz = srxz;
+                } else if (bclo == REFLECT_ODD) {
+                    slxz = 0.0;
+                    srxz = 0.0;
                 }
-                slxz = srxz;
-            } else if (bclo == REFLECT_EVEN) {
-                slxz = srxz;
-            } else if (bclo == REFLECT_ODD) {
-                slxz = 0.0;
-                srxz = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (i == domhi[0] + 1) {
-            if (bchi == EXT_DIR) {
-                slxz = scal(i, j, k, comp);
-                srxz = scal(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 0) {
-                    slxz = amrex::max(slxz, 0.0);
+                // impose hi side bc's
+            } else if (i == domhi[0] + 1) {
+                if (bchi == EXT_DIR) {
+                    slxz = scal(i, j, k, c);
+                    srxz = scal(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 0) {
+                        slxz = amrex::max(slxz, 0.0);
+                    }
+                    srxz = slxz;
+                } else if (bchi == REFLECT_EVEN) {
+                    srxz = slxz;
+                } else if (bchi == REFLECT_ODD) {
+                    slxz = 0.0;
+                    srxz = 0.0;
                 }
-                srxz = slxz;
-            } else if (bchi == REFLECT_EVEN) {
-                srxz = slxz;
-            } else if (bchi == REFLECT_ODD) {
-                slxz = 0.0;
-                srxz = 0.0;
             }
-        }
 
-        // make simhxy by solving Riemann problem
-        simhxz(i, j, k) = (umac(i, j, k) > 0.0) ? slxz : srxz;
-        simhxz(i, j, k) = (amrex::Math::abs(umac(i, j, k)) > rel_eps_local)
-                              ? simhxz(i, j, k)
-                              : 0.5 * (slxz + srxz);
+            // make simhxy by solving Riemann problem
+            simhxz(i, j, k, n) = (umac(i, j, k) > 0.0) ? slxz : srxz;
+            simhxz(i, j, k, n) =
+                (amrex::Math::abs(umac(i, j, k)) > rel_eps_local)
+                    ? simhxz(i, j, k, n)
+                    : 0.5 * (slxz + srxz);
+        }
     });
 
     // simhyx
@@ -1057,74 +1086,80 @@ void Maestro::MakeEdgeScalTransverse(
     bchi = bcs[bccomp].hi()[1];
 
     ParallelFor(imhbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        Real slyx = 0.0;
-        Real sryx = 0.0;
-        // loop over appropriate yx faces
-        if (is_conservative) {
-            // make slyx, sryx by updating 1D extrapolation
-            slyx =
-                sly(i, j, k) -
-                (dt3 / hx) * (simhx(i + 1, j - 1, k) * umac(i + 1, j - 1, k) -
-                              simhx(i, j - 1, k) * umac(i, j - 1, k)) -
-                dt3 * scal(i, j - 1, k, comp) * divu(i, j - 1, k) +
-                (dt3 / hx) * scal(i, j - 1, k, comp) *
-                    (umac(i + 1, j - 1, k) - umac(i, j - 1, k));
-            sryx = sry(i, j, k) -
-                   (dt3 / hx) * (simhx(i + 1, j, k) * umac(i + 1, j, k) -
-                                 simhx(i, j, k) * umac(i, j, k)) -
-                   dt3 * scal(i, j, k, comp) * divu(i, j, k) +
-                   (dt3 / hx) * scal(i, j, k, comp) *
-                       (umac(i + 1, j, k) - umac(i, j, k));
-        } else {
-            // make slyx, sryx by updating 1D extrapolation
-            slyx = sly(i, j, k) -
-                   (dt6 / hx) * (umac(i + 1, j - 1, k) + umac(i, j - 1, k)) *
-                       (simhx(i + 1, j - 1, k) - simhx(i, j - 1, k));
-            sryx = sry(i, j, k) - (dt6 / hx) *
-                                      (umac(i + 1, j, k) + umac(i, j, k)) *
-                                      (simhx(i + 1, j, k) - simhx(i, j, k));
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+
+            Real slyx = 0.0;
+            Real sryx = 0.0;
+            // loop over appropriate yx faces
+            if (is_conservative) {
+                // make slyx, sryx by updating 1D extrapolation
+                slyx = sly(i, j, k, n) -
+                       (dt3 / hx) *
+                           (simhx(i + 1, j - 1, k, n) * umac(i + 1, j - 1, k) -
+                            simhx(i, j - 1, k, n) * umac(i, j - 1, k)) -
+                       dt3 * scal(i, j - 1, k, c) * divu(i, j - 1, k) +
+                       (dt3 / hx) * scal(i, j - 1, k, c) *
+                           (umac(i + 1, j - 1, k) - umac(i, j - 1, k));
+                sryx = sry(i, j, k, n) -
+                       (dt3 / hx) * (simhx(i + 1, j, k, n) * umac(i + 1, j, k) -
+                                     simhx(i, j, k, n) * umac(i, j, k)) -
+                       dt3 * scal(i, j, k, c) * divu(i, j, k) +
+                       (dt3 / hx) * scal(i, j, k, c) *
+                           (umac(i + 1, j, k) - umac(i, j, k));
+            } else {
+                // make slyx, sryx by updating 1D extrapolation
+                slyx = sly(i, j, k, n) -
+                       (dt6 / hx) *
+                           (umac(i + 1, j - 1, k) + umac(i, j - 1, k)) *
+                           (simhx(i + 1, j - 1, k, n) - simhx(i, j - 1, k, n));
+                sryx = sry(i, j, k, n) -
+                       (dt6 / hx) * (umac(i + 1, j, k) + umac(i, j, k)) *
+                           (simhx(i + 1, j, k, n) - simhx(i, j, k, n));
+            }
 
-        // impose lo side bc's
-        if (j == domlo[1]) {
-            if (bclo == EXT_DIR) {
-                slyx = scal(i, j - 1, k, comp);
-                sryx = scal(i, j - 1, k, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 1) {
-                    sryx = amrex::min(sryx, 0.0);
+            // impose lo side bc's
+            if (j == domlo[1]) {
+                if (bclo == EXT_DIR) {
+                    slyx = scal(i, j - 1, k, c);
+                    sryx = scal(i, j - 1, k, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 1) {
+                        sryx = amrex::min(sryx, 0.0);
+                    }
+                    slyx = sryx;
+                } else if (bclo == REFLECT_EVEN) {
+                    slyx = sryx;
+                } else if (bclo == REFLECT_ODD) {
+                    slyx = 0.0;
+                    sryx = 0.0;
                 }
-                slyx = sryx;
-            } else if (bclo == REFLECT_EVEN) {
-                slyx = sryx;
-            } else if (bclo == REFLECT_ODD) {
-                slyx = 0.0;
-                sryx = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (j == domhi[1] + 1) {
-            if (bchi == EXT_DIR) {
-                slyx = scal(i, j, k, comp);
-                sryx = scal(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 1) {
-                    slyx = amrex::max(slyx, 0.0);
+                // impose hi side bc's
+            } else if (j == domhi[1] + 1) {
+                if (bchi == EXT_DIR) {
+                    slyx = scal(i, j, k, c);
+                    sryx = scal(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 1) {
+                        slyx = amrex::max(slyx, 0.0);
+                    }
+                    sryx = slyx;
+                } else if (bchi == REFLECT_EVEN) {
+                    sryx = slyx;
+                } else if (bchi == REFLECT_ODD) {
+                    slyx = 0.0;
+                    sryx = 0.0;
                 }
-                sryx = slyx;
-            } else if (bchi == REFLECT_EVEN) {
-                sryx = slyx;
-            } else if (bchi == REFLECT_ODD) {
-                slyx = 0.0;
-                sryx = 0.0;
             }
-        }
 
-        // make simhxy by solving Riemann problem
-        simhyx(i, j, k) = (vmac(i, j, k) > 0.0) ? slyx : sryx;
-        simhyx(i, j, k) = (amrex::Math::abs(vmac(i, j, k)) > rel_eps_local)
-                              ? simhyx(i, j, k)
-                              : 0.5 * (slyx + sryx);
+            // make simhxy by solving Riemann problem
+            simhyx(i, j, k, n) = (vmac(i, j, k) > 0.0) ? slyx : sryx;
+            simhyx(i, j, k, n) =
+                (amrex::Math::abs(vmac(i, j, k)) > rel_eps_local)
+                    ? simhyx(i, j, k, n)
+                    : 0.5 * (slyx + sryx);
+        }
     });
 
     // simhyz
@@ -1133,74 +1168,80 @@ void Maestro::MakeEdgeScalTransverse(
     imhbox = amrex::growHi(imhbox, 1, 1);
 
     ParallelFor(imhbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        Real slyz = 0.0;
-        Real sryz = 0.0;
-        // loop over appropriate yz faces
-        if (is_conservative) {
-            // make slyz, sryz by updating 1D extrapolation
-            slyz =
-                sly(i, j, k) -
-                (dt3 / hz) * (simhz(i, j - 1, k + 1) * wmac(i, j - 1, k + 1) -
-                              simhz(i, j - 1, k) * wmac(i, j - 1, k)) -
-                dt3 * scal(i, j - 1, k, comp) * divu(i, j - 1, k) +
-                (dt3 / hz) * scal(i, j - 1, k, comp) *
-                    (wmac(i, j - 1, k + 1) - wmac(i, j - 1, k));
-            sryz = sry(i, j, k) -
-                   (dt3 / hz) * (simhz(i, j, k + 1) * wmac(i, j, k + 1) -
-                                 simhz(i, j, k) * wmac(i, j, k)) -
-                   dt3 * scal(i, j, k, comp) * divu(i, j, k) +
-                   (dt3 / hz) * scal(i, j, k, comp) *
-                       (wmac(i, j, k + 1) - wmac(i, j, k));
-        } else {
-            // make slyz, sryz by updating 1D extrapolation
-            slyz = sly(i, j, k) -
-                   (dt6 / hz) * (wmac(i, j - 1, k + 1) + wmac(i, j - 1, k)) *
-                       (simhz(i, j - 1, k + 1) - simhz(i, j - 1, k));
-            sryz = sry(i, j, k) - (dt6 / hz) *
-                                      (wmac(i, j, k + 1) + wmac(i, j, k)) *
-                                      (simhz(i, j, k + 1) - simhz(i, j, k));
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+
+            Real slyz = 0.0;
+            Real sryz = 0.0;
+            // loop over appropriate yz faces
+            if (is_conservative) {
+                // make slyz, sryz by updating 1D extrapolation
+                slyz = sly(i, j, k, n) -
+                       (dt3 / hz) *
+                           (simhz(i, j - 1, k + 1, n) * wmac(i, j - 1, k + 1) -
+                            simhz(i, j - 1, k, n) * wmac(i, j - 1, k)) -
+                       dt3 * scal(i, j - 1, k, c) * divu(i, j - 1, k) +
+                       (dt3 / hz) * scal(i, j - 1, k, c) *
+                           (wmac(i, j - 1, k + 1) - wmac(i, j - 1, k));
+                sryz = sry(i, j, k, n) -
+                       (dt3 / hz) * (simhz(i, j, k + 1, n) * wmac(i, j, k + 1) -
+                                     simhz(i, j, k, n) * wmac(i, j, k)) -
+                       dt3 * scal(i, j, k, c) * divu(i, j, k) +
+                       (dt3 / hz) * scal(i, j, k, c) *
+                           (wmac(i, j, k + 1) - wmac(i, j, k));
+            } else {
+                // make slyz, sryz by updating 1D extrapolation
+                slyz = sly(i, j, k, n) -
+                       (dt6 / hz) *
+                           (wmac(i, j - 1, k + 1) + wmac(i, j - 1, k)) *
+                           (simhz(i, j - 1, k + 1, n) - simhz(i, j - 1, k, n));
+                sryz = sry(i, j, k, n) -
+                       (dt6 / hz) * (wmac(i, j, k + 1) + wmac(i, j, k)) *
+                           (simhz(i, j, k + 1, n) - simhz(i, j, k, n));
+            }
 
-        // impose lo side bc's
-        if (j == domlo[1]) {
-            if (bclo == EXT_DIR) {
-                slyz = scal(i, j - 1, k, comp);
-                sryz = scal(i, j - 1, k, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 1) {
-                    sryz = amrex::min(sryz, 0.0);
+            // impose lo side bc's
+            if (j == domlo[1]) {
+                if (bclo == EXT_DIR) {
+                    slyz = scal(i, j - 1, k, c);
+                    sryz = scal(i, j - 1, k, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 1) {
+                        sryz = amrex::min(sryz, 0.0);
+                    }
+                    slyz = sryz;
+                } else if (bclo == REFLECT_EVEN) {
+                    slyz = sryz;
+                } else if (bclo == REFLECT_ODD) {
+                    slyz = 0.0;
+                    sryz = 0.0;
                 }
-                slyz = sryz;
-            } else if (bclo == REFLECT_EVEN) {
-                slyz = sryz;
-            } else if (bclo == REFLECT_ODD) {
-                slyz = 0.0;
-                sryz = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (j == domhi[1] + 1) {
-            if (bchi == EXT_DIR) {
-                slyz = scal(i, j, k, comp);
-                sryz = scal(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 1) {
-                    slyz = amrex::max(slyz, 0.0);
+                // impose hi side bc's
+            } else if (j == domhi[1] + 1) {
+                if (bchi == EXT_DIR) {
+                    slyz = scal(i, j, k, c);
+                    sryz = scal(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 1) {
+                        slyz = amrex::max(slyz, 0.0);
+                    }
+                    sryz = slyz;
+                } else if (bchi == REFLECT_EVEN) {
+                    sryz = slyz;
+                } else if (bchi == REFLECT_ODD) {
+                    slyz = 0.0;
+                    sryz = 0.0;
                 }
-                sryz = slyz;
-            } else if (bchi == REFLECT_EVEN) {
-                sryz = slyz;
-            } else if (bchi == REFLECT_ODD) {
-                slyz = 0.0;
-                sryz = 0.0;
             }
-        }
 
-        // make simhyz by solving Riemann problem
-        simhyz(i, j, k) = (vmac(i, j, k) > 0.0) ? slyz : sryz;
-        simhyz(i, j, k) = (amrex::Math::abs(vmac(i, j, k)) > rel_eps_local)
-                              ? simhyz(i, j, k)
-                              : 0.5 * (slyz + sryz);
+            // make simhyz by solving Riemann problem
+            simhyz(i, j, k, n) = (vmac(i, j, k) > 0.0) ? slyz : sryz;
+            simhyz(i, j, k, n) =
+                (amrex::Math::abs(vmac(i, j, k)) > rel_eps_local)
+                    ? simhyz(i, j, k, n)
+                    : 0.5 * (slyz + sryz);
+        }
     });
 
     // simhzx
@@ -1212,74 +1253,80 @@ void Maestro::MakeEdgeScalTransverse(
     bchi = bcs[bccomp].hi()[2];
 
     ParallelFor(imhbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        Real slzx = 0.0;
-        Real srzx = 0.0;
-        // loop over appropriate zx faces
-        if (is_conservative) {
-            // make slzx, srzx by updating 1D extrapolation
-            slzx =
-                slz(i, j, k) -
-                (dt3 / hx) * (simhx(i + 1, j, k - 1) * umac(i + 1, j, k - 1) -
-                              simhx(i, j, k - 1) * umac(i, j, k - 1)) -
-                dt3 * scal(i, j, k - 1, comp) * divu(i, j, k - 1) +
-                (dt3 / hx) * scal(i, j, k - 1, comp) *
-                    (umac(i + 1, j, k - 1) - umac(i, j, k - 1));
-            srzx = srz(i, j, k) -
-                   (dt3 / hx) * (simhx(i + 1, j, k) * umac(i + 1, j, k) -
-                                 simhx(i, j, k) * umac(i, j, k)) -
-                   dt3 * scal(i, j, k, comp) * divu(i, j, k) +
-                   (dt3 / hx) * scal(i, j, k, comp) *
-                       (umac(i + 1, j, k) - umac(i, j, k));
-        } else {
-            // make slzx, srzx by updating 1D extrapolation
-            slzx = slz(i, j, k) -
-                   (dt6 / hx) * (umac(i + 1, j, k - 1) + umac(i, j, k - 1)) *
-                       (simhx(i + 1, j, k - 1) - simhx(i, j, k - 1));
-            srzx = srz(i, j, k) - (dt6 / hx) *
-                                      (umac(i + 1, j, k) + umac(i, j, k)) *
-                                      (simhx(i + 1, j, k) - simhx(i, j, k));
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+
+            Real slzx = 0.0;
+            Real srzx = 0.0;
+            // loop over appropriate zx faces
+            if (is_conservative) {
+                // make slzx, srzx by updating 1D extrapolation
+                slzx = slz(i, j, k, n) -
+                       (dt3 / hx) *
+                           (simhx(i + 1, j, k - 1, n) * umac(i + 1, j, k - 1) -
+                            simhx(i, j, k - 1, n) * umac(i, j, k - 1)) -
+                       dt3 * scal(i, j, k - 1, c) * divu(i, j, k - 1) +
+                       (dt3 / hx) * scal(i, j, k - 1, c) *
+                           (umac(i + 1, j, k - 1) - umac(i, j, k - 1));
+                srzx = srz(i, j, k, n) -
+                       (dt3 / hx) * (simhx(i + 1, j, k, n) * umac(i + 1, j, k) -
+                                     simhx(i, j, k, n) * umac(i, j, k)) -
+                       dt3 * scal(i, j, k, c) * divu(i, j, k) +
+                       (dt3 / hx) * scal(i, j, k, c) *
+                           (umac(i + 1, j, k) - umac(i, j, k));
+            } else {
+                // make slzx, srzx by updating 1D extrapolation
+                slzx = slz(i, j, k, n) -
+                       (dt6 / hx) *
+                           (umac(i + 1, j, k - 1) + umac(i, j, k - 1)) *
+                           (simhx(i + 1, j, k - 1, n) - simhx(i, j, k - 1, n));
+                srzx = srz(i, j, k, n) -
+                       (dt6 / hx) * (umac(i + 1, j, k) + umac(i, j, k)) *
+                           (simhx(i + 1, j, k, n) - simhx(i, j, k, n));
+            }
 
-        // impose lo side bc's
-        if (k == domlo[2]) {
-            if (bclo == EXT_DIR) {
-                slzx = scal(i, j, k - 1, comp);
-                srzx = scal(i, j, k - 1, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 2) {
-                    srzx = amrex::min(srzx, 0.0);
+            // impose lo side bc's
+            if (k == domlo[2]) {
+                if (bclo == EXT_DIR) {
+                    slzx = scal(i, j, k - 1, c);
+                    srzx = scal(i, j, k - 1, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 2) {
+                        srzx = amrex::min(srzx, 0.0);
+                    }
+                    slzx = srzx;
+                } else if (bclo == REFLECT_EVEN) {
+                    slzx = srzx;
+                } else if (bclo == REFLECT_ODD) {
+                    slzx = 0.0;
+                    srzx = 0.0;
                 }
-                slzx = srzx;
-            } else if (bclo == REFLECT_EVEN) {
-                slzx = srzx;
-            } else if (bclo == REFLECT_ODD) {
-                slzx = 0.0;
-                srzx = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (k == domhi[2] + 1) {
-            if (bchi == EXT_DIR) {
-                slzx = scal(i, j, k, comp);
-                srzx = scal(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 2) {
-                    slzx = amrex::max(slzx, 0.0);
+                // impose hi side bc's
+            } else if (k == domhi[2] + 1) {
+                if (bchi == EXT_DIR) {
+                    slzx = scal(i, j, k, c);
+                    srzx = scal(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 2) {
+                        slzx = amrex::max(slzx, 0.0);
+                    }
+                    srzx = slzx;
+                } else if (bchi == REFLECT_EVEN) {
+                    srzx = slzx;
+                } else if (bchi == REFLECT_ODD) {
+                    slzx = 0.0;
+                    srzx = 0.0;
                 }
-                srzx = slzx;
-            } else if (bchi == REFLECT_EVEN) {
-                srzx = slzx;
-            } else if (bchi == REFLECT_ODD) {
-                slzx = 0.0;
-                srzx = 0.0;
             }
-        }
 
-        // make simhzx by solving Riemann problem
-        simhzx(i, j, k) = (wmac(i, j, k) > 0.0) ? slzx : srzx;
-        simhzx(i, j, k) = (amrex::Math::abs(wmac(i, j, k)) > rel_eps_local)
-                              ? simhzx(i, j, k)
-                              : 0.5 * (slzx + srzx);
+            // make simhzx by solving Riemann problem
+            simhzx(i, j, k, n) = (wmac(i, j, k) > 0.0) ? slzx : srzx;
+            simhzx(i, j, k, n) =
+                (amrex::Math::abs(wmac(i, j, k)) > rel_eps_local)
+                    ? simhzx(i, j, k, n)
+                    : 0.5 * (slzx + srzx);
+        }
     });
 
     // simhzy
@@ -1288,74 +1335,80 @@ void Maestro::MakeEdgeScalTransverse(
     imhbox = amrex::growHi(imhbox, 2, 1);
 
     ParallelFor(imhbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        Real slzy = 0.0;
-        Real srzy = 0.0;
-        // loop over appropriate zy faces
-        if (is_conservative) {
-            // make slzy, srzy by updating 1D extrapolation
-            slzy =
-                slz(i, j, k) -
-                (dt3 / hy) * (simhy(i, j + 1, k - 1) * vmac(i, j + 1, k - 1) -
-                              simhy(i, j, k - 1) * vmac(i, j, k - 1)) -
-                dt3 * scal(i, j, k - 1, comp) * divu(i, j, k - 1) +
-                (dt3 / hy) * scal(i, j, k - 1, comp) *
-                    (vmac(i, j + 1, k - 1) - vmac(i, j, k - 1));
-            srzy = srz(i, j, k) -
-                   (dt3 / hy) * (simhy(i, j + 1, k) * vmac(i, j + 1, k) -
-                                 simhy(i, j, k) * vmac(i, j, k)) -
-                   dt3 * scal(i, j, k, comp) * divu(i, j, k) +
-                   (dt3 / hy) * scal(i, j, k, comp) *
-                       (vmac(i, j + 1, k) - vmac(i, j, k));
-        } else {
-            // make slzy, srzy by updating 1D extrapolation
-            slzy = slz(i, j, k) -
-                   (dt6 / hy) * (vmac(i, j + 1, k - 1) + vmac(i, j, k - 1)) *
-                       (simhy(i, j + 1, k - 1) - simhy(i, j, k - 1));
-            srzy = srz(i, j, k) - (dt6 / hy) *
-                                      (vmac(i, j + 1, k) + vmac(i, j, k)) *
-                                      (simhy(i, j + 1, k) - simhy(i, j, k));
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+
+            Real slzy = 0.0;
+            Real srzy = 0.0;
+            // loop over appropriate zy faces
+            if (is_conservative) {
+                // make slzy, srzy by updating 1D extrapolation
+                slzy = slz(i, j, k, n) -
+                       (dt3 / hy) *
+                           (simhy(i, j + 1, k - 1, n) * vmac(i, j + 1, k - 1) -
+                            simhy(i, j, k - 1, n) * vmac(i, j, k - 1)) -
+                       dt3 * scal(i, j, k - 1, c) * divu(i, j, k - 1) +
+                       (dt3 / hy) * scal(i, j, k - 1, c) *
+                           (vmac(i, j + 1, k - 1) - vmac(i, j, k - 1));
+                srzy = srz(i, j, k, n) -
+                       (dt3 / hy) * (simhy(i, j + 1, k, n) * vmac(i, j + 1, k) -
+                                     simhy(i, j, k, n) * vmac(i, j, k)) -
+                       dt3 * scal(i, j, k, c) * divu(i, j, k) +
+                       (dt3 / hy) * scal(i, j, k, c) *
+                           (vmac(i, j + 1, k) - vmac(i, j, k));
+            } else {
+                // make slzy, srzy by updating 1D extrapolation
+                slzy = slz(i, j, k, n) -
+                       (dt6 / hy) *
+                           (vmac(i, j + 1, k - 1) + vmac(i, j, k - 1)) *
+                           (simhy(i, j + 1, k - 1, n) - simhy(i, j, k - 1, n));
+                srzy = srz(i, j, k, n) -
+                       (dt6 / hy) * (vmac(i, j + 1, k) + vmac(i, j, k)) *
+                           (simhy(i, j + 1, k, n) - simhy(i, j, k, n));
+            }
 
-        // impose lo side bc's
-        if (k == domlo[2]) {
-            if (bclo == EXT_DIR) {
-                slzy = scal(i, j, k - 1, comp);
-                srzy = scal(i, j, k - 1, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 2) {
-                    srzy = amrex::min(srzy, 0.0);
+            // impose lo side bc's
+            if (k == domlo[2]) {
+                if (bclo == EXT_DIR) {
+                    slzy = scal(i, j, k - 1, c);
+                    srzy = scal(i, j, k - 1, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 2) {
+                        srzy = amrex::min(srzy, 0.0);
+                    }
+                    slzy = srzy;
+                } else if (bclo == REFLECT_EVEN) {
+                    slzy = srzy;
+                } else if (bclo == REFLECT_ODD) {
+                    slzy = 0.0;
+                    srzy = 0.0;
                 }
-                slzy = srzy;
-            } else if (bclo == REFLECT_EVEN) {
-                slzy = srzy;
-            } else if (bclo == REFLECT_ODD) {
-                slzy = 0.0;
-                srzy = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (k == domhi[2] + 1) {
-            if (bchi == EXT_DIR) {
-                slzy = scal(i, j, k, comp);
-                srzy = scal(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 2) {
-                    slzy = amrex::max(slzy, 0.0);
+                // impose hi side bc's
+            } else if (k == domhi[2] + 1) {
+                if (bchi == EXT_DIR) {
+                    slzy = scal(i, j, k, c);
+                    srzy = scal(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 2) {
+                        slzy = amrex::max(slzy, 0.0);
+                    }
+                    srzy = slzy;
+                } else if (bchi == REFLECT_EVEN) {
+                    srzy = slzy;
+                } else if (bchi == REFLECT_ODD) {
+                    slzy = 0.0;
+                    srzy = 0.0;
                 }
-                srzy = slzy;
-            } else if (bchi == REFLECT_EVEN) {
-                srzy = slzy;
-            } else if (bchi == REFLECT_ODD) {
-                slzy = 0.0;
-                srzy = 0.0;
             }
-        }
 
-        // make simhzy by solving Riemann problem
-        simhzy(i, j, k) = (wmac(i, j, k) > 0.0) ? slzy : srzy;
-        simhzy(i, j, k) = (amrex::Math::abs(wmac(i, j, k)) > rel_eps_local)
-                              ? simhzy(i, j, k)
-                              : 0.5 * (slzy + srzy);
+            // make simhzy by solving Riemann problem
+            simhzy(i, j, k, n) = (wmac(i, j, k) > 0.0) ? slzy : srzy;
+            simhzy(i, j, k, n) =
+                (amrex::Math::abs(wmac(i, j, k)) > rel_eps_local)
+                    ? simhzy(i, j, k, n)
+                    : 0.5 * (slzy + srzy);
+        }
     });
 }
 
@@ -1370,7 +1423,8 @@ void Maestro::MakeEdgeScalEdges(
     Array4<Real> const simhyx, Array4<Real> const simhyz,
     Array4<Real> const simhzx, Array4<Real> const simhzy, const Box& domainBox,
     const Vector<BCRec>& bcs, const amrex::GpuArray<Real, AMREX_SPACEDIM> dx,
-    int comp, int bccomp, const bool is_vel, const bool is_conservative) {
+    int comp, int bccomp, int ncomp, const bool is_vel,
+    const bool is_conservative) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeEdgeScalEdges()", MakeEdgeScalEdges);
 
@@ -1400,88 +1454,98 @@ void Maestro::MakeEdgeScalEdges(
     int bclo = bcs[bccomp].lo()[0];
     int bchi = bcs[bccomp].hi()[0];
     ParallelFor(xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        Real sedgelx = 0.0;
-        Real sedgerx = 0.0;
-
-        Real fl = (ppm_trace_forces_local == 0) ? force(i - 1, j, k, comp)
-                                                : Ipf(i - 1, j, k, 0);
-        Real fr = (ppm_trace_forces_local == 0) ? force(i, j, k, comp)
-                                                : Imf(i, j, k, 0);
-
-        // make sedgelx, sedgerx
-        if (is_conservative) {
-            sedgelx =
-                slx(i, j, k) -
-                (dt2 / hy) * (simhyz(i - 1, j + 1, k) * vmac(i - 1, j + 1, k) -
-                              simhyz(i - 1, j, k) * vmac(i - 1, j, k)) -
-                (dt2 / hz) * (simhzy(i - 1, j, k + 1) * wmac(i - 1, j, k + 1) -
-                              simhzy(i - 1, j, k) * wmac(i - 1, j, k)) -
-                (dt2 / hx) * scal(i - 1, j, k, comp) *
-                    (umac(i, j, k) - umac(i - 1, j, k)) +
-                dt2 * fl;
-
-            sedgerx = srx(i, j, k) -
-                      (dt2 / hy) * (simhyz(i, j + 1, k) * vmac(i, j + 1, k) -
-                                    simhyz(i, j, k) * vmac(i, j, k)) -
-                      (dt2 / hz) * (simhzy(i, j, k + 1) * wmac(i, j, k + 1) -
-                                    simhzy(i, j, k) * wmac(i, j, k)) -
-                      (dt2 / hx) * scal(i, j, k, comp) *
-                          (umac(i + 1, j, k) - umac(i, j, k)) +
-                      dt2 * fr;
-        } else {
-            sedgelx = slx(i, j, k) -
-                      (dt4 / hy) * (vmac(i - 1, j + 1, k) + vmac(i - 1, j, k)) *
-                          (simhyz(i - 1, j + 1, k) - simhyz(i - 1, j, k)) -
-                      (dt4 / hz) * (wmac(i - 1, j, k + 1) + wmac(i - 1, j, k)) *
-                          (simhzy(i - 1, j, k + 1) - simhzy(i - 1, j, k)) +
-                      dt2 * fl;
-
-            sedgerx = srx(i, j, k) -
-                      (dt4 / hy) * (vmac(i, j + 1, k) + vmac(i, j, k)) *
-                          (simhyz(i, j + 1, k) - simhyz(i, j, k)) -
-                      (dt4 / hz) * (wmac(i, j, k + 1) + wmac(i, j, k)) *
-                          (simhzy(i, j, k + 1) - simhzy(i, j, k)) +
-                      dt2 * fr;
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+            const int nd = AMREX_SPACEDIM * n;
+
+            Real sedgelx = 0.0;
+            Real sedgerx = 0.0;
+
+            Real fl = (ppm_trace_forces_local == 0) ? force(i - 1, j, k, c)
+                                                    : Ipf(i - 1, j, k, nd);
+            Real fr = (ppm_trace_forces_local == 0) ? force(i, j, k, c)
+                                                    : Imf(i, j, k, nd);
+
+            // make sedgelx, sedgerx
+            if (is_conservative) {
+                sedgelx =
+                    slx(i, j, k, n) -
+                    (dt2 / hy) *
+                        (simhyz(i - 1, j + 1, k, n) * vmac(i - 1, j + 1, k) -
+                         simhyz(i - 1, j, k, n) * vmac(i - 1, j, k)) -
+                    (dt2 / hz) *
+                        (simhzy(i - 1, j, k + 1, n) * wmac(i - 1, j, k + 1) -
+                         simhzy(i - 1, j, k, n) * wmac(i - 1, j, k)) -
+                    (dt2 / hx) * scal(i - 1, j, k, c) *
+                        (umac(i, j, k) - umac(i - 1, j, k)) +
+                    dt2 * fl;
+
+                sedgerx = srx(i, j, k, n) -
+                          (dt2 / hy) *
+                              (simhyz(i, j + 1, k, n) * vmac(i, j + 1, k) -
+                               simhyz(i, j, k, n) * vmac(i, j, k)) -
+                          (dt2 / hz) *
+                              (simhzy(i, j, k + 1, n) * wmac(i, j, k + 1) -
+                               simhzy(i, j, k, n) * wmac(i, j, k)) -
+                          (dt2 / hx) * scal(i, j, k, c) *
+                              (umac(i + 1, j, k) - umac(i, j, k)) +
+                          dt2 * fr;
+            } else {
+                sedgelx =
+                    slx(i, j, k, n) -
+                    (dt4 / hy) * (vmac(i - 1, j + 1, k) + vmac(i - 1, j, k)) *
+                        (simhyz(i - 1, j + 1, k, n) - simhyz(i - 1, j, k, n)) -
+                    (dt4 / hz) * (wmac(i - 1, j, k + 1) + wmac(i - 1, j, k)) *
+                        (simhzy(i - 1, j, k + 1, n) - simhzy(i - 1, j, k, n)) +
+                    dt2 * fl;
+
+                sedgerx = srx(i, j, k, n) -
+                          (dt4 / hy) * (vmac(i, j + 1, k) + vmac(i, j, k)) *
+                              (simhyz(i, j + 1, k, n) - simhyz(i, j, k, n)) -
+                          (dt4 / hz) * (wmac(i, j, k + 1) + wmac(i, j, k)) *
+                              (simhzy(i, j, k + 1, n) - simhzy(i, j, k, n)) +
+                          dt2 * fr;
+            }
 
-        // make sedgex by solving Riemann problem
-        // boundary conditions enforced outside of i,j,k loop
-        sedgex(i, j, k, comp) = (umac(i, j, k) > 0.0) ? sedgelx : sedgerx;
-        sedgex(i, j, k, comp) =
-            (amrex::Math::abs(umac(i, j, k)) > rel_eps_local)
-                ? sedgex(i, j, k, comp)
-                : 0.5 * (sedgelx + sedgerx);
-
-        // impose lo side bc's
-        if (i == domlo[0]) {
-            if (bclo == EXT_DIR) {
-                sedgex(i, j, k, comp) = scal(i - 1, j, k, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 0) {
-                    sedgex(i, j, k, comp) = amrex::min(sedgerx, 0.0);
-                } else {
-                    sedgex(i, j, k, comp) = sedgerx;
+            // make sedgex by solving Riemann problem
+            // boundary conditions enforced outside of i,j,k loop
+            sedgex(i, j, k, c) = (umac(i, j, k) > 0.0) ? sedgelx : sedgerx;
+            sedgex(i, j, k, c) =
+                (amrex::Math::abs(umac(i, j, k)) > rel_eps_local)
+                    ? sedgex(i, j, k, c)
+                    : 0.5 * (sedgelx + sedgerx);
+
+            // impose lo side bc's
+            if (i == domlo[0]) {
+                if (bclo == EXT_DIR) {
+                    sedgex(i, j, k, c) = scal(i - 1, j, k, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 0) {
+                        sedgex(i, j, k, c) = amrex::min(sedgerx, 0.0);
+                    } else {
+                        sedgex(i, j, k, c) = sedgerx;
+                    }
+                } else if (bclo == REFLECT_EVEN) {
+                    sedgex(i, j, k, c) = sedgerx;
+                } else if (bclo == REFLECT_ODD) {
+                    sedgex(i, j, k, c) = 0.0;
                 }
-            } else if (bclo == REFLECT_EVEN) {
-                sedgex(i, j, k, comp) = sedgerx;
-            } else if (bclo == REFLECT_ODD) {
-                sedgex(i, j, k, comp) = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (i == domhi[0] + 1) {
-            if (bchi == EXT_DIR) {
-                sedgex(i, j, k, comp) = scal(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 0) {
-                    sedgex(i, j, k, comp) = amrex::max(sedgelx, 0.0);
-                } else {
-                    sedgex(i, j, k, comp) = sedgelx;
+                // impose hi side bc's
+            } else if (i == domhi[0] + 1) {
+                if (bchi == EXT_DIR) {
+                    sedgex(i, j, k, c) = scal(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 0) {
+                        sedgex(i, j, k, c) = amrex::max(sedgelx, 0.0);
+                    } else {
+                        sedgex(i, j, k, c) = sedgelx;
+                    }
+                } else if (bchi == REFLECT_EVEN) {
+                    sedgex(i, j, k, c) = sedgelx;
+                } else if (bchi == REFLECT_ODD) {
+                    sedgex(i, j, k, c) = 0.0;
                 }
-            } else if (bchi == REFLECT_EVEN) {
-                sedgex(i, j, k, comp) = sedgelx;
-            } else if (bchi == REFLECT_ODD) {
-                sedgex(i, j, k, comp) = 0.0;
             }
         }
     });
@@ -1490,88 +1554,98 @@ void Maestro::MakeEdgeScalEdges(
     bclo = bcs[bccomp].lo()[1];
     bchi = bcs[bccomp].hi()[1];
     ParallelFor(ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        Real sedgely = 0.0;
-        Real sedgery = 0.0;
-
-        Real fl = (ppm_trace_forces_local == 0) ? force(i, j - 1, k, comp)
-                                                : Ipf(i, j - 1, k, 1);
-        Real fr = (ppm_trace_forces_local == 0) ? force(i, j, k, comp)
-                                                : Imf(i, j, k, 1);
-
-        // make sedgely, sedgery
-        if (is_conservative) {
-            sedgely =
-                sly(i, j, k) -
-                (dt2 / hx) * (simhxz(i + 1, j - 1, k) * umac(i + 1, j - 1, k) -
-                              simhxz(i, j - 1, k) * umac(i, j - 1, k)) -
-                (dt2 / hz) * (simhzx(i, j - 1, k + 1) * wmac(i, j - 1, k + 1) -
-                              simhzx(i, j - 1, k) * wmac(i, j - 1, k)) -
-                (dt2 / hy) * scal(i, j - 1, k, comp) *
-                    (vmac(i, j, k) - vmac(i, j - 1, k)) +
-                dt2 * fl;
-
-            sedgery = sry(i, j, k) -
-                      (dt2 / hx) * (simhxz(i + 1, j, k) * umac(i + 1, j, k) -
-                                    simhxz(i, j, k) * umac(i, j, k)) -
-                      (dt2 / hz) * (simhzx(i, j, k + 1) * wmac(i, j, k + 1) -
-                                    simhzx(i, j, k) * wmac(i, j, k)) -
-                      (dt2 / hy) * scal(i, j, k, comp) *
-                          (vmac(i, j + 1, k) - vmac(i, j, k)) +
-                      dt2 * fr;
-        } else {
-            sedgely = sly(i, j, k) -
-                      (dt4 / hx) * (umac(i + 1, j - 1, k) + umac(i, j - 1, k)) *
-                          (simhxz(i + 1, j - 1, k) - simhxz(i, j - 1, k)) -
-                      (dt4 / hz) * (wmac(i, j - 1, k + 1) + wmac(i, j - 1, k)) *
-                          (simhzx(i, j - 1, k + 1) - simhzx(i, j - 1, k)) +
-                      dt2 * fl;
-
-            sedgery = sry(i, j, k) -
-                      (dt4 / hx) * (umac(i + 1, j, k) + umac(i, j, k)) *
-                          (simhxz(i + 1, j, k) - simhxz(i, j, k)) -
-                      (dt4 / hz) * (wmac(i, j, k + 1) + wmac(i, j, k)) *
-                          (simhzx(i, j, k + 1) - simhzx(i, j, k)) +
-                      dt2 * fr;
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+            const int nd = AMREX_SPACEDIM * n;
+
+            Real sedgely = 0.0;
+            Real sedgery = 0.0;
+
+            Real fl = (ppm_trace_forces_local == 0) ? force(i, j - 1, k, c)
+                                                    : Ipf(i, j - 1, k, nd + 1);
+            Real fr = (ppm_trace_forces_local == 0) ? force(i, j, k, c)
+                                                    : Imf(i, j, k, nd + 1);
+
+            // make sedgely, sedgery
+            if (is_conservative) {
+                sedgely =
+                    sly(i, j, k, n) -
+                    (dt2 / hx) *
+                        (simhxz(i + 1, j - 1, k, n) * umac(i + 1, j - 1, k) -
+                         simhxz(i, j - 1, k, n) * umac(i, j - 1, k)) -
+                    (dt2 / hz) *
+                        (simhzx(i, j - 1, k + 1, n) * wmac(i, j - 1, k + 1) -
+                         simhzx(i, j - 1, k, n) * wmac(i, j - 1, k)) -
+                    (dt2 / hy) * scal(i, j - 1, k, c) *
+                        (vmac(i, j, k) - vmac(i, j - 1, k)) +
+                    dt2 * fl;
+
+                sedgery = sry(i, j, k, n) -
+                          (dt2 / hx) *
+                              (simhxz(i + 1, j, k, n) * umac(i + 1, j, k) -
+                               simhxz(i, j, k, n) * umac(i, j, k)) -
+                          (dt2 / hz) *
+                              (simhzx(i, j, k + 1, n) * wmac(i, j, k + 1) -
+                               simhzx(i, j, k, n) * wmac(i, j, k)) -
+                          (dt2 / hy) * scal(i, j, k, c) *
+                              (vmac(i, j + 1, k) - vmac(i, j, k)) +
+                          dt2 * fr;
+            } else {
+                sedgely =
+                    sly(i, j, k, n) -
+                    (dt4 / hx) * (umac(i + 1, j - 1, k) + umac(i, j - 1, k)) *
+                        (simhxz(i + 1, j - 1, k, n) - simhxz(i, j - 1, k, n)) -
+                    (dt4 / hz) * (wmac(i, j - 1, k + 1) + wmac(i, j - 1, k)) *
+                        (simhzx(i, j - 1, k + 1, n) - simhzx(i, j - 1, k, n)) +
+                    dt2 * fl;
+
+                sedgery = sry(i, j, k, n) -
+                          (dt4 / hx) * (umac(i + 1, j, k) + umac(i, j, k)) *
+                              (simhxz(i + 1, j, k, n) - simhxz(i, j, k, n)) -
+                          (dt4 / hz) * (wmac(i, j, k + 1) + wmac(i, j, k)) *
+                              (simhzx(i, j, k + 1, n) - simhzx(i, j, k, n)) +
+                          dt2 * fr;
+            }
 
-        // make sedgey by solving Riemann problem
-        // boundary conditions enforced outside of i,j,k loop
-        sedgey(i, j, k, comp) = (vmac(i, j, k) > 0.0) ? sedgely : sedgery;
-        sedgey(i, j, k, comp) =
-            (amrex::Math::abs(vmac(i, j, k)) > rel_eps_local)
-                ? sedgey(i, j, k, comp)
-                : 0.5 * (sedgely + sedgery);
-
-        // impose lo side bc's
-        if (j == domlo[1]) {
-            if (bclo == EXT_DIR) {
-                sedgey(i, j, k, comp) = scal(i, j - 1, k, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 1) {
-                    sedgey(i, j, k, comp) = amrex::min(sedgery, 0.0);
-                } else {
-                    sedgey(i, j, k, comp) = sedgery;
+            // make sedgey by solving Riemann problem
+            // boundary conditions enforced outside of i,j,k loop
+            sedgey(i, j, k, c) = (vmac(i, j, k) > 0.0) ? sedgely : sedgery;
+            sedgey(i, j, k, c) =
+                (amrex::Math::abs(vmac(i, j, k)) > rel_eps_local)
+                    ? sedgey(i, j, k, c)
+                    : 0.5 * (sedgely + sedgery);
+
+            // impose lo side bc's
+            if (j == domlo[1]) {
+                if (bclo == EXT_DIR) {
+                    sedgey(i, j, k, c) = scal(i, j - 1, k, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 1) {
+                        sedgey(i, j, k, c) = amrex::min(sedgery, 0.0);
+                    } else {
+                        sedgey(i, j, k, c) = sedgery;
+                    }
+                } else if (bclo == REFLECT_EVEN) {
+                    sedgey(i, j, k, c) = sedgery;
+                } else if (bclo == REFLECT_ODD) {
+                    sedgey(i, j, k, c) = 0.0;
                 }
-            } else if (bclo == REFLECT_EVEN) {
-                sedgey(i, j, k, comp) = sedgery;
-            } else if (bclo == REFLECT_ODD) {
-                sedgey(i, j, k, comp) = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (j == domhi[1] + 1) {
-            if (bchi == EXT_DIR) {
-                sedgey(i, j, k, comp) = scal(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 1) {
-                    sedgey(i, j, k, comp) = amrex::max(sedgely, 0.0);
-                } else {
-                    sedgey(i, j, k, comp) = sedgely;
+                // impose hi side bc's
+            } else if (j == domhi[1] + 1) {
+                if (bchi == EXT_DIR) {
+                    sedgey(i, j, k, c) = scal(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 1) {
+                        sedgey(i, j, k, c) = amrex::max(sedgely, 0.0);
+                    } else {
+                        sedgey(i, j, k, c) = sedgely;
+                    }
+                } else if (bchi == REFLECT_EVEN) {
+                    sedgey(i, j, k, c) = sedgely;
+                } else if (bchi == REFLECT_ODD) {
+                    sedgey(i, j, k, c) = 0.0;
                 }
-            } else if (bchi == REFLECT_EVEN) {
-                sedgey(i, j, k, comp) = sedgely;
-            } else if (bchi == REFLECT_ODD) {
-                sedgey(i, j, k, comp) = 0.0;
             }
         }
     });
@@ -1580,88 +1654,98 @@ void Maestro::MakeEdgeScalEdges(
     bclo = bcs[bccomp].lo()[2];
     bchi = bcs[bccomp].hi()[2];
     ParallelFor(zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-        Real sedgelz = 0.0;
-        Real sedgerz = 0.0;
-
-        Real fl = (ppm_trace_forces_local == 0) ? force(i, j, k - 1, comp)
-                                                : Ipf(i, j, k - 1, 2);
-        Real fr = (ppm_trace_forces_local == 0) ? force(i, j, k, comp)
-                                                : Imf(i, j, k, 2);
-
-        // make sedgelz, sedgerz
-        if (is_conservative) {
-            sedgelz =
-                slz(i, j, k) -
-                (dt2 / hx) * (simhxy(i + 1, j, k - 1) * umac(i + 1, j, k - 1) -
-                              simhxy(i, j, k - 1) * umac(i, j, k - 1)) -
-                (dt2 / hy) * (simhyx(i, j + 1, k - 1) * vmac(i, j + 1, k - 1) -
-                              simhyx(i, j, k - 1) * vmac(i, j, k - 1)) -
-                (dt2 / hz) * scal(i, j, k - 1, comp) *
-                    (wmac(i, j, k) - wmac(i, j, k - 1)) +
-                dt2 * fl;
-
-            sedgerz = srz(i, j, k) -
-                      (dt2 / hx) * (simhxy(i + 1, j, k) * umac(i + 1, j, k) -
-                                    simhxy(i, j, k) * umac(i, j, k)) -
-                      (dt2 / hy) * (simhyx(i, j + 1, k) * vmac(i, j + 1, k) -
-                                    simhyx(i, j, k) * vmac(i, j, k)) -
-                      (dt2 / hz) * scal(i, j, k, comp) *
-                          (wmac(i, j, k + 1) - wmac(i, j, k)) +
-                      dt2 * fr;
-        } else {
-            sedgelz = slz(i, j, k) -
-                      (dt4 / hx) * (umac(i + 1, j, k - 1) + umac(i, j, k - 1)) *
-                          (simhxy(i + 1, j, k - 1) - simhxy(i, j, k - 1)) -
-                      (dt4 / hy) * (vmac(i, j + 1, k - 1) + vmac(i, j, k - 1)) *
-                          (simhyx(i, j + 1, k - 1) - simhyx(i, j, k - 1)) +
-                      dt2 * fl;
-
-            sedgerz = srz(i, j, k) -
-                      (dt4 / hx) * (umac(i + 1, j, k) + umac(i, j, k)) *
-                          (simhxy(i + 1, j, k) - simhxy(i, j, k)) -
-                      (dt4 / hy) * (vmac(i, j + 1, k) + vmac(i, j, k)) *
-                          (simhyx(i, j + 1, k) - simhyx(i, j, k)) +
-                      dt2 * fr;
-        }
+        for (int n = 0; n < ncomp; ++n) {
+            const int c = comp + n;
+            const int nd = AMREX_SPACEDIM * n;
+
+            Real sedgelz = 0.0;
+            Real sedgerz = 0.0;
+
+            Real fl = (ppm_trace_forces_local == 0) ? force(i, j, k - 1, c)
+                                                    : Ipf(i, j, k - 1, nd + 2);
+            Real fr = (ppm_trace_forces_local == 0) ? force(i, j, k, c)
+                                                    : Imf(i, j, k, nd + 2);
+
+            // make sedgelz, sedgerz
+            if (is_conservative) {
+                sedgelz =
+                    slz(i, j, k, n) -
+                    (dt2 / hx) *
+                        (simhxy(i + 1, j, k - 1, n) * umac(i + 1, j, k - 1) -
+                         simhxy(i, j, k - 1, n) * umac(i, j, k - 1)) -
+                    (dt2 / hy) *
+                        (simhyx(i, j + 1, k - 1, n) * vmac(i, j + 1, k - 1) -
+                         simhyx(i, j, k - 1, n) * vmac(i, j, k - 1)) -
+                    (dt2 / hz) * scal(i, j, k - 1, c) *
+                        (wmac(i, j, k) - wmac(i, j, k - 1)) +
+                    dt2 * fl;
+
+                sedgerz = srz(i, j, k, n) -
+                          (dt2 / hx) *
+                              (simhxy(i + 1, j, k, n) * umac(i + 1, j, k) -
+                               simhxy(i, j, k, n) * umac(i, j, k)) -
+                          (dt2 / hy) *
+                              (simhyx(i, j + 1, k, n) * vmac(i, j + 1, k) -
+                               simhyx(i, j, k, n) * vmac(i, j, k)) -
+                          (dt2 / hz) * scal(i, j, k, c) *
+                              (wmac(i, j, k + 1) - wmac(i, j, k)) +
+                          dt2 * fr;
+            } else {
+                sedgelz =
+                    slz(i, j, k, n) -
+                    (dt4 / hx) * (umac(i + 1, j, k - 1) + umac(i, j, k - 1)) *
+                        (simhxy(i + 1, j, k - 1, n) - simhxy(i, j, k - 1, n)) -
+                    (dt4 / hy) * (vmac(i, j + 1, k - 1) + vmac(i, j, k - 1)) *
+                        (simhyx(i, j + 1, k - 1, n) - simhyx(i, j, k - 1, n)) +
+                    dt2 * fl;
+
+                sedgerz = srz(i, j, k, n) -
+                          (dt4 / hx) * (umac(i + 1, j, k) + umac(i, j, k)) *
+                              (simhxy(i + 1, j, k, n) - simhxy(i, j, k, n)) -
+                          (dt4 / hy) * (vmac(i, j + 1, k) + vmac(i, j, k)) *
+                              (simhyx(i, j + 1, k, n) - simhyx(i, j, k, n)) +
+                          dt2 * fr;
+            }
 
-        // make sedgez by solving Riemann problem
-        // boundary conditions enforced outside of i,j,k loop
-        sedgez(i, j, k, comp) = (wmac(i, j, k) > 0.0) ? sedgelz : sedgerz;
-        sedgez(i, j, k, comp) =
-            (amrex::Math::abs(wmac(i, j, k)) > rel_eps_local)
-                ? sedgez(i, j, k, comp)
-                : 0.5 * (sedgelz + sedgerz);
-
-        // impose lo side bc's
-        if (k == domlo[2]) {
-            if (bclo == EXT_DIR) {
-                sedgez(i, j, k, comp) = scal(i, j, k - 1, comp);
-            } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
-                if (is_vel && comp == 2) {
-                    sedgez(i, j, k, comp) = amrex::min(sedgerz, 0.0);
-                } else {
-                    sedgez(i, j, k, comp) = sedgerz;
+            // make sedgez by solving Riemann problem
+            // boundary conditions enforced outside of i,j,k loop
+            sedgez(i, j, k, c) = (wmac(i, j, k) > 0.0) ? sedgelz : sedgerz;
+            sedgez(i, j, k, c) =
+                (amrex::Math::abs(wmac(i, j, k)) > rel_eps_local)
+                    ? sedgez(i, j, k, c)
+                    : 0.5 * (sedgelz + sedgerz);
+
+            // impose lo side bc's
+            if (k == domlo[2]) {
+                if (bclo == EXT_DIR) {
+                    sedgez(i, j, k, c) = scal(i, j, k - 1, c);
+                } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
+                    if (is_vel && c == 2) {
+                        sedgez(i, j, k, c) = amrex::min(sedgerz, 0.0);
+                    } else {
+                        sedgez(i, j, k, c) = sedgerz;
+                    }
+                } else if (bclo == REFLECT_EVEN) {
+                    sedgez(i, j, k, c) = sedgerz;
+                } else if (bclo == REFLECT_ODD) {
+                    sedgez(i, j, k, c) = 0.0;
                 }
-            } else if (bclo == REFLECT_EVEN) {
-                sedgez(i, j, k, comp) = sedgerz;
-            } else if (bclo == REFLECT_ODD) {
-                sedgez(i, j, k, comp) = 0.0;
-            }
 
-            // impose hi side bc's
-        } else if (k == domhi[2] + 1) {
-            if (bchi == EXT_DIR) {
-                sedgez(i, j, k, comp) = scal(i, j, k, comp);
-            } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
-                if (is_vel && comp == 2) {
-                    sedgez(i, j, k, comp) = amrex::max(sedgelz, 0.0);
-                } else {
-                    sedgez(i, j, k, comp) = sedgelz;
+                // impose hi side bc's
+            } else if (k == domhi[2] + 1) {
+                if (bchi == EXT_DIR) {
+                    sedgez(i, j, k, c) = scal(i, j, k, c);
+                } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
+                    if (is_vel && c == 2) {
+                        sedgez(i, j, k, c) = amrex::max(sedgelz, 0.0);
+                    } else {
+                        sedgez(i, j, k, c) = sedgelz;
+                    }
+                } else if (bchi == REFLECT_EVEN) {
+                    sedgez(i, j, k, c) = sedgelz;
+                } else if (bchi == REFLECT_ODD) {
+                    sedgez(i, j, k, c) = 0.0;
                 }
-            } else if (bchi == REFLECT_EVEN) {
-                sedgez(i, j, k, comp) = sedgelz;
-            } else if (bchi == REFLECT_ODD) {
-                sedgez(i, j, k, comp) = 0.0;
             }
         }
     });
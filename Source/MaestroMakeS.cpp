@@ -1,5 +1,6 @@
 
 #include <Maestro.H>
+#include <MaestroEos.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
@@ -96,6 +97,17 @@ void Maestro::Make_S_cc(
     const auto use_omegadot_terms_in_S_loc = use_omegadot_terms_in_S;
     const auto use_delta_gamma1_term_loc = use_delta_gamma1_term;
 
+    // the EOS fields of scal, if they are cached
+    Vector<int> eos_fields = {EosCache_cp, EosCache_dpdT, EosCache_dpdr};
+    if (use_omegadot_terms_in_S) {
+        eos_fields.push_back(EosCache_dhdX);
+        eos_fields.push_back(EosCache_dpdX);
+    }
+    if (use_delta_gamma1_term) {
+        eos_fields.push_back(EosCache_gam1);
+    }
+    const Vector<MultiFab>* eos_cache = GetEosCache(scal, eos_fields);
+
     for (int lev = 0; lev <= finest_level; ++lev) {
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -121,149 +133,124 @@ void Maestro::Make_S_cc(
                 gradp0_cart[lev].array(mfi);
             const Array4<const Real> gamma1bar_arr =
                 gamma1bar_cart[lev].array(mfi);
+            const Array4<const Real> cache_arr =
+                eos_cache ? (*eos_cache)[lev].const_array(mfi)
+                          : Array4<const Real>{};
 
             if (spherical) {
 #if (AMREX_SPACEDIM == 3)
                 const Array4<const Real> normal_arr = normal[lev].array(mfi);
 
-                ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                    eos_t eos_state;
-
-                    eos_state.rho = scal_arr(i, j, k, Rho);
-                    eos_state.T = scal_arr(i, j, k, Temp);
-                    for (auto n = 0; n < NumSpec; ++n) {
-                        eos_state.xn[n] =
-                            scal_arr(i, j, k, FirstSpec + n) / eos_state.rho;
-                    }
-#if NAUX_NET > 0
-                    for (auto n = 0; n < NumAux; ++n) {
-                        eos_state.aux[n] =
-                            scal_arr(i, j, k, FirstAux + n) / eos_state.rho;
-                    }
-#endif
-
-                    // dens, temp, and xmass are inputs
-                    eos(eos_input_rt, eos_state);
-
-                    auto eos_xderivs = composition_derivatives(eos_state);
-
-                    Real sigma =
-                        eos_state.dpdT /
-                        (eos_state.rho * eos_state.cp * eos_state.dpdr);
-
-                    Real xi_term = 0.0;
-                    Real pres_term = 0.0;
+                // dens, temp, and xmass are inputs
+                EosDerivSweep(
+                    tileBox, scal_arr, cache_arr, eos_cache_idx,
+                    use_omegadot_terms_in_S_loc, false,
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                         const eos_t& eos_state,
+                                         const eos_xderivs_t& eos_xderivs) {
+                        Real sigma =
+                            eos_state.dpdT /
+                            (eos_state.rho * eos_state.cp * eos_state.dpdr);
+
+                        Real xi_term = 0.0;
+                        Real pres_term = 0.0;
+
+                        if (use_omegadot_terms_in_S_loc) {
+                            for (auto comp = 0; comp < NumSpec; ++comp) {
+                                xi_term -= eos_xderivs.dhdX[comp] *
+                                           rho_odot_arr(i, j, k, comp) /
+                                           eos_state.rho;
+
+                                pres_term += eos_xderivs.dpdX[comp] *
+                                             rho_odot_arr(i, j, k, comp) /
+                                             eos_state.rho;
+                            }
+                        }
 
-                    if (use_omegadot_terms_in_S_loc) {
-                        for (auto comp = 0; comp < NumSpec; ++comp) {
-                            xi_term -= eos_xderivs.dhdX[comp] *
-                                       rho_odot_arr(i, j, k, comp) /
-                                       eos_state.rho;
+                        S_cc_arr(i, j, k) =
+                            (sigma / eos_state.rho) *
+                                (rho_Hext_arr(i, j, k) + rho_Hnuc_arr(i, j, k) +
+                                 thermal_arr(i, j, k)) +
+                            sigma * xi_term +
+                            pres_term / (eos_state.rho * eos_state.dpdr);
+
+                        if (use_delta_gamma1_term_loc) {
+                            delta_gamma1_arr(i, j, k) =
+                                eos_state.gam1 - gamma1bar_arr(i, j, k);
+
+                            Real U_dot_er = 0.0;
+                            for (auto n = 0; n < AMREX_SPACEDIM; ++n) {
+                                U_dot_er +=
+                                    u_arr(i, j, k, n) * normal_arr(i, j, k, n);
+                            }
 
-                            pres_term += eos_xderivs.dpdX[comp] *
-                                         rho_odot_arr(i, j, k, comp) /
-                                         eos_state.rho;
+                            delta_gamma1_term_arr(i, j, k) =
+                                (eos_state.gam1 - gamma1bar_arr(i, j, k)) *
+                                u_arr(i, j, k, AMREX_SPACEDIM - 1) *
+                                gradp0_cart_arr(i, j, k) /
+                                (gamma1bar_arr(i, j, k) *
+                                 gamma1bar_arr(i, j, k) * p0_arr(i, j, k));
+                        } else {
+                            delta_gamma1_term_arr(i, j, k) = 0.0;
+                            delta_gamma1_arr(i, j, k) = 0.0;
                         }
-                    }
-
-                    S_cc_arr(i, j, k) =
-                        (sigma / eos_state.rho) *
-                            (rho_Hext_arr(i, j, k) + rho_Hnuc_arr(i, j, k) +
-                             thermal_arr(i, j, k)) +
-                        sigma * xi_term +
-                        pres_term / (eos_state.rho * eos_state.dpdr);
-
-                    if (use_delta_gamma1_term_loc) {
-                        delta_gamma1_arr(i, j, k) =
-                            eos_state.gam1 - gamma1bar_arr(i, j, k);
-
-                        Real U_dot_er = 0.0;
-                        for (auto n = 0; n < AMREX_SPACEDIM; ++n) {
-                            U_dot_er +=
-                                u_arr(i, j, k, n) * normal_arr(i, j, k, n);
-                        }
-
-                        delta_gamma1_term_arr(i, j, k) =
-                            (eos_state.gam1 - gamma1bar_arr(i, j, k)) *
-                            u_arr(i, j, k, AMREX_SPACEDIM - 1) *
-                            gradp0_cart_arr(i, j, k) /
-                            (gamma1bar_arr(i, j, k) * gamma1bar_arr(i, j, k) *
-                             p0_arr(i, j, k));
-                    } else {
-                        delta_gamma1_term_arr(i, j, k) = 0.0;
-                        delta_gamma1_arr(i, j, k) = 0.0;
-                    }
-                });
+                    });
 #endif
             } else {
                 const auto anelastic_cutoff_density_coord_lev =
                     base_geom.anelastic_cutoff_density_coord(lev);
 
-                ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                    eos_t eos_state;
-
-                    eos_state.rho = scal_arr(i, j, k, Rho);
-                    eos_state.T = scal_arr(i, j, k, Temp);
-                    for (auto n = 0; n < NumSpec; ++n) {
-                        eos_state.xn[n] =
-                            scal_arr(i, j, k, FirstSpec + n) / eos_state.rho;
-                    }
-#if NAUX_NET > 0
-                    for (auto n = 0; n < NumAux; ++n) {
-                        eos_state.aux[n] =
-                            scal_arr(i, j, k, FirstAux + n) / eos_state.rho;
-                    }
-#endif
-
-                    // dens, temp, and xmass are inputs
-                    eos(eos_input_rt, eos_state);
-
-                    auto eos_xderivs = composition_derivatives(eos_state);
-
-                    Real sigma =
-                        eos_state.dpdT /
-                        (eos_state.rho * eos_state.cp * eos_state.dpdr);
-
-                    Real xi_term = 0.0;
-                    Real pres_term = 0.0;
-
-                    if (use_omegadot_terms_in_S_loc) {
-                        for (auto comp = 0; comp < NumSpec; ++comp) {
-                            xi_term -= eos_xderivs.dhdX[comp] *
-                                       rho_odot_arr(i, j, k, comp) /
-                                       eos_state.rho;
+                // dens, temp, and xmass are inputs
+                EosDerivSweep(
+                    tileBox, scal_arr, cache_arr, eos_cache_idx,
+                    use_omegadot_terms_in_S_loc, false,
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                         const eos_t& eos_state,
+                                         const eos_xderivs_t& eos_xderivs) {
+                        Real sigma =
+                            eos_state.dpdT /
+                            (eos_state.rho * eos_state.cp * eos_state.dpdr);
+
+                        Real xi_term = 0.0;
+                        Real pres_term = 0.0;
+
+                        if (use_omegadot_terms_in_S_loc) {
+                            for (auto comp = 0; comp < NumSpec; ++comp) {
+                                xi_term -= eos_xderivs.dhdX[comp] *
+                                           rho_odot_arr(i, j, k, comp) /
+                                           eos_state.rho;
+
+                                pres_term += eos_xderivs.dpdX[comp] *
+                                             rho_odot_arr(i, j, k, comp) /
+                                             eos_state.rho;
+                            }
+                        }
 
-                            pres_term += eos_xderivs.dpdX[comp] *
-                                         rho_odot_arr(i, j, k, comp) /
-                                         eos_state.rho;
+                        S_cc_arr(i, j, k) =
+                            (sigma / eos_state.rho) *
+                                (rho_Hext_arr(i, j, k) + rho_Hnuc_arr(i, j, k) +
+                                 thermal_arr(i, j, k)) +
+                            sigma * xi_term +
+                            pres_term / (eos_state.rho * eos_state.dpdr);
+
+                        int r = AMREX_SPACEDIM == 2 ? j : k;
+
+                        if (use_delta_gamma1_term_loc &&
+                            r < anelastic_cutoff_density_coord_lev) {
+                            delta_gamma1_arr(i, j, k) =
+                                eos_state.gam1 - gamma1bar_arr(i, j, k);
+
+                            delta_gamma1_term_arr(i, j, k) =
+                                (eos_state.gam1 - gamma1bar_arr(i, j, k)) *
+                                u_arr(i, j, k, AMREX_SPACEDIM - 1) *
+                                gradp0_cart_arr(i, j, k) /
+                                (gamma1bar_arr(i, j, k) *
+                                 gamma1bar_arr(i, j, k) * p0_arr(i, j, k));
+                        } else {
+                            delta_gamma1_term_arr(i, j, k) = 0.0;
+                            delta_gamma1_arr(i, j, k) = 0.0;
                         }
-                    }
-
-                    S_cc_arr(i, j, k) =
-                        (sigma / eos_state.rho) *
-                            (rho_Hext_arr(i, j, k) + rho_Hnuc_arr(i, j, k) +
-                             thermal_arr(i, j, k)) +
-                        sigma * xi_term +
-                        pres_term / (eos_state.rho * eos_state.dpdr);
-
-                    int r = AMREX_SPACEDIM == 2 ? j : k;
-
-                    if (use_delta_gamma1_term_loc &&
-                        r < anelastic_cutoff_density_coord_lev) {
-                        delta_gamma1_arr(i, j, k) =
-                            eos_state.gam1 - gamma1bar_arr(i, j, k);
-
-                        delta_gamma1_term_arr(i, j, k) =
-                            (eos_state.gam1 - gamma1bar_arr(i, j, k)) *
-                            u_arr(i, j, k, AMREX_SPACEDIM - 1) *
-                            gradp0_cart_arr(i, j, k) /
-                            (gamma1bar_arr(i, j, k) * gamma1bar_arr(i, j, k) *
-                             p0_arr(i, j, k));
-                    } else {
-                        delta_gamma1_term_arr(i, j, k) = 0.0;
-                        delta_gamma1_arr(i, j, k) = 0.0;
-                    }
-                });
+                    });
             }
         }
     }
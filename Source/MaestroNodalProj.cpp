@@ -147,43 +147,10 @@ void Maestro::NodalProj(int proj_type, Vector<MultiFab>& rhcc,
  */
     SetBoundaryVelocity(Vproj);
 
-    std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_lobc;
-    std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_hibc;
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-        if (Geom(0).isPeriodic(idim)) {
-            mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
-        } else {
-            if (phys_bc[idim] == Outflow) {
-                mlmg_lobc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            }
-
-            if (phys_bc[AMREX_SPACEDIM + idim] == Outflow) {
-                mlmg_hibc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            }
-        }
-    }
-
-    LPInfo info;
-    info.setMetricTerm(false);
-
-    if (hg_bottom_solver == 4) {
-        info.setAgglomeration(true);
-        info.setConsolidation(true);
-    } else {
-        info.setAgglomeration(false);
-        info.setConsolidation(false);
-    }
+    // the operator is kept across calls, so only sig is set here
+    Real setup_start = ParallelDescriptor::second();
 
-    // Only pass up to defined level to prevent looping over undefined grids.
-    MLNodeLaplacian mlndlap(Geom(0, finest_level), grids, dmap, info);
-    mlndlap.setGaussSeidel(true);
-    mlndlap.setHarmonicAverage(false);
-
-    mlndlap.setDomainBC(mlmg_lobc, mlmg_hibc);
+    MLNodeLaplacian& mlndlap = NodalSolver();
 
     // set sig in the MLNodeLaplacian object
     for (int ilev = 0; ilev <= finest_level; ++ilev) {
@@ -204,6 +171,17 @@ void Maestro::NodalProj(int proj_type, Vector<MultiFab>& rhcc,
         phi[lev].setVal(0.);
     }
 
+    // start from the solution of the last projection of this type.  The
+    // regular time step solution is dt * pi, so it is scaled to the new dt,
+    // and there is nothing to start from until one has been saved.
+    Vector<MultiFab>& phi_prev = nodal_phi_prev[proj_type - 1];
+    const bool is_regular = proj_type == regular_timestep_comp;
+    bool warm_start = false;
+    if (warm_start_projections && (!is_regular || nodal_phi_prev_dt > 0.0)) {
+        const Real phi_scale = is_regular ? dt / nodal_phi_prev_dt : 1.0;
+        warm_start = LoadWarmStart(phi_prev, phi, phi_scale);
+    }
+
     // multiply rhcc = beta0*(S-Sbar) by -1 since we want
     // rhstotal to contain div(beta*Vproj) - beta0*(S-Sbar)
     for (int lev = 0; lev <= finest_level; ++lev) {
@@ -242,6 +220,12 @@ void Maestro::NodalProj(int proj_type, Vector<MultiFab>& rhcc,
     mlmg.setVerbose(mg_verbose);
     mlmg.setBottomVerbose(cg_verbose);
 
+    // measure the relative tolerance against the RHS alone, as from a zero
+    // guess, rather than against the small initial residual of a warm start
+    if (warm_start) {
+        mlmg.setAlwaysUseBNorm(true);
+    }
+
     Real abs_tol = -1.;  // disable absolute tolerance
     Real rel_tol = 1.e-3;
 
@@ -284,6 +268,9 @@ void Maestro::NodalProj(int proj_type, Vector<MultiFab>& rhcc,
             amrex::min(eps_hg_max, eps_hg * pow(hg_level_factor, finest_level));
     }
 
+    Real solve_start = ParallelDescriptor::second();
+    nodal_solver_times.setup += solve_start - setup_start;
+
     // solve for phi
     Print() << "Calling nodal solver" << std::endl;
 #ifdef AMREX_USE_CUDA
@@ -303,6 +290,24 @@ void Maestro::NodalProj(int proj_type, Vector<MultiFab>& rhcc,
 #endif
     Print() << "Done calling nodal solver" << std::endl;
 
+    const Real solve_time = ParallelDescriptor::second() - solve_start;
+    nodal_solver_times.solve += solve_time;
+    ++nodal_solver_times.calls;
+    nodal_solver_times.iters += mlmg.getNumIters();
+    if (warm_start) {
+        ++nodal_solver_times.warm_starts;
+    }
+
+    if (warm_start_projections) {
+        SaveWarmStart(phi, phi_prev);
+        if (proj_type == regular_timestep_comp) {
+            nodal_phi_prev_dt = dt;
+        }
+    }
+
+    LogSolve(SolverLog_nodal, proj_type, mlmg, rel_tol,
+             solve_start - setup_start, solve_time);
+
     // convert beta0*Vproj back to Vproj
     for (int lev = 0; lev <= finest_level; ++lev) {
         for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
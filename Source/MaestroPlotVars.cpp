@@ -0,0 +1,1817 @@
+
+#include <Maestro.H>
+#include <Maestro_F.H>
+
+using namespace amrex;
+
+// put together a vector of multifabs holding the plot variables
+// plot_varnames, computing only the quantities they need
+Vector<const MultiFab*> Maestro::PlotFileVarsMF(
+    const Vector<std::string>& plot_varnames, const Real t_in,
+    const Real dt_in, const BaseState<Real>& rho0_in,
+    const BaseState<Real>& rhoh0_in, const BaseState<Real>& p0_in,
+    const BaseState<Real>& gamma1bar_in, const Vector<MultiFab>& u_in,
+    Vector<MultiFab>& s_in, const Vector<MultiFab>& S_cc_in) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::PlotFileVarsMF()", PlotFileVarsMF);
+
+    const int nPlot = plot_varnames.size();
+
+    // MultiFab to hold plotfile data
+    Vector<const MultiFab*> plot_mf;
+
+    // temporary MultiFab to hold plotfile data
+    Vector<MultiFab*> plot_mf_data(finest_level + 1);
+
+    // build temporary MultiFab to hold plotfile data
+    for (int i = 0; i <= finest_level; ++i) {
+        plot_mf_data[i] = new MultiFab((s_in[i]).boxArray(),
+                                       (s_in[i]).DistributionMap(), nPlot, 0);
+    }
+
+    BaseState<Real> tempbar_plot(base_geom.max_radial_level + 1,
+                                 base_geom.nr_fine);
+    tempbar_plot.setVal(0.);
+
+    // define a Vector of single-level MultiFabs on the grids
+    const auto define_mf = [&](Vector<MultiFab>& mf, const int ncomp,
+                               const int ngrow) {
+        mf.resize(finest_level + 1);
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            mf[lev].define(grids[lev], dmap[lev], ncomp, ngrow);
+        }
+    };
+
+    // the quantities that several plot variables depend on, computed the
+    // first time one of them is needed
+
+    // magvel: magvel, momentum
+    Vector<MultiFab> magvel;
+    const auto get_magvel = [&]() -> const Vector<MultiFab>& {
+        if (magvel.empty()) {
+            define_mf(magvel, 1, 0);
+            MakeMagvel(u_in, magvel);
+        }
+        return magvel;
+    };
+
+    // reaction rates (rho_omegadot, rho_Hnuc) and rho_Hext: omegadot,
+    // Hext, Hnuc.  These see the temperature s_in came with.
+    Vector<MultiFab> rho_Hext;
+    const auto get_rho_Hext = [&]() -> const Vector<MultiFab>& {
+        if (rho_Hext.empty()) {
+            define_mf(rho_Hext, 1, 0);
+            MakeReactionRatesForOutput(s_in, rho_Hext, p0_in, dt_in, t_in);
+        }
+        return rho_Hext;
+    };
+
+    // the temperature in s_in: tfromp, tfromh, deltap and deltaT derive it
+    // from (rho, p0) and (rho, h), and the variables that come after them
+    // in the plotfile see the one MAESTRO uses (from p0 if use_tfromp)
+    enum TempSource { temp_in, temp_from_p, temp_from_h };
+    TempSource temp_source = temp_in;
+    const auto set_temp = [&](const TempSource source) {
+        if (source == temp_source || source == temp_in) {
+            return;
+        }
+        if (source == temp_from_p) {
+            TfromRhoP(s_in, p0_in);
+        } else {
+            TfromRhoH(s_in, p0_in);
+        }
+        temp_source = source;
+    };
+    const auto set_final_temp = [&]() {
+        set_temp(use_tfromp ? temp_from_p : temp_from_h);
+    };
+
+    // entropy: entropy, entropypert
+    Vector<MultiFab> entropy;
+    const auto get_entropy = [&]() -> const Vector<MultiFab>& {
+        if (entropy.empty()) {
+            set_final_temp();
+            define_mf(entropy, 1, 0);
+            MakeEntropy(s_in, entropy);
+        }
+        return entropy;
+    };
+
+    // w0 on a Cartesian grid: MachNumber, divw0, radial_velocity,
+    // circ_velocity
+    Vector<std::array<MultiFab, AMREX_SPACEDIM> > w0mac(finest_level + 1);
+    Vector<MultiFab> w0r_cart;
+    const auto get_w0r_cart = [&]() -> const Vector<MultiFab>& {
+        if (!w0r_cart.empty()) {
+            return w0r_cart;
+        }
+
+        define_mf(w0r_cart, 1, 1);
+
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            if (spherical) {
+                // w0mac will contain an edge-centered w0 on a Cartesian grid,
+                // for use in computing divergences.
+                AMREX_D_TERM(
+                    w0mac[lev][0].define(convert(grids[lev], nodal_flag_x),
+                                         dmap[lev], 1, 1);
+                    , w0mac[lev][1].define(convert(grids[lev], nodal_flag_y),
+                                           dmap[lev], 1, 1);
+                    , w0mac[lev][2].define(convert(grids[lev], nodal_flag_z),
+                                           dmap[lev], 1, 1););
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    w0mac[lev][idim].setVal(0.);
+                }
+            }
+
+            // w0r_cart is w0 but onto a Cartesian grid in cell-centered as
+            // a scalar.  Since w0 is the radial expansion velocity, w0r_cart
+            // is the radial w0 in a zone
+            w0r_cart[lev].setVal(0.);
+        }
+
+        if (evolve_base_state) {
+#if (AMREX_SPACEDIM == 3)
+            if (spherical) {
+                MakeW0mac(w0mac);
+            }
+#endif
+            Put1dArrayOnCart(w0, w0r_cart, true, false, bcs_u, 0);
+        }
+        return w0r_cart;
+    };
+
+    // thermal coefficients and thermal term: thermal, conductivity
+    Vector<MultiFab> Tcoeff;
+    Vector<MultiFab> thermal;
+    const auto get_thermal = [&]() {
+        if (!thermal.empty()) {
+            return;
+        }
+
+        define_mf(Tcoeff, 1, 1);
+        define_mf(thermal, 1, 0);
+
+        if (use_thermal_diffusion) {
+            set_final_temp();
+
+            Vector<MultiFab> hcoeff;
+            Vector<MultiFab> Xkcoeff;
+            Vector<MultiFab> pcoeff;
+            define_mf(hcoeff, 1, 1);
+            define_mf(Xkcoeff, NumSpec, 1);
+            define_mf(pcoeff, 1, 1);
+
+            MakeThermalCoeffs(s_in, Tcoeff, hcoeff, Xkcoeff, pcoeff);
+            MakeExplicitThermal(thermal, s_in, Tcoeff, hcoeff, Xkcoeff, pcoeff,
+                                p0_in, 0);
+        } else {
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                Tcoeff[lev].setVal(0.);
+                thermal[lev].setVal(0.);
+            }
+        }
+    };
+
+    // go through the registry in plotfile order, so each variable sees the
+    // same state as it would in a full plotfile
+    for (const auto& var : PlotVarRegistry()) {
+        // the components of the plot variable to write, and where to
+        const int ncomp = var.names.size();
+        Vector<std::pair<int, int> > comps;
+        for (int n = 0; n < ncomp; ++n) {
+            for (int dest = 0; dest < nPlot; ++dest) {
+                if (plot_varnames[dest] == var.names[n]) {
+                    comps.push_back({n, dest});
+                }
+            }
+        }
+        if (comps.empty()) {
+            continue;
+        }
+
+        // the plot variable
+        Vector<MultiFab> mf;
+        define_mf(mf, ncomp, 0);
+
+        switch (var.id) {
+            case PlotVar_vel:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], u_in[i], 0, 0, AMREX_SPACEDIM, 0);
+                }
+                break;
+
+            case PlotVar_magvel:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], get_magvel()[i], 0, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_momentum:
+                // momentum = magvel * rho
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], get_magvel()[i], 0, 0, 1, 0);
+                    MultiFab::Multiply(mf[i], s_in[i], Rho, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_vort:
+                MakeVorticity(u_in, mf);
+                break;
+
+            case PlotVar_rho:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], Rho, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_rhoh:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], RhoH, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_h:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], RhoH, 0, 1, 0);
+                    MultiFab::Divide(mf[i], s_in[i], Rho, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_rhoX:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], FirstSpec, 0, NumSpec, 0);
+                }
+                break;
+
+            case PlotVar_X:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], FirstSpec, 0, NumSpec, 0);
+                    for (int comp = 0; comp < NumSpec; ++comp) {
+                        MultiFab::Divide(mf[i], s_in[i], Rho, comp, 1, 0);
+                    }
+                }
+                break;
+
+            case PlotVar_abar:
+                MakeAbar(s_in, mf);
+                break;
+
+            case PlotVar_omegadot:
+                get_rho_Hext();
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], rho_omegadot[i], 0, 0, NumSpec, 0);
+                    for (int comp = 0; comp < NumSpec; ++comp) {
+                        MultiFab::Divide(mf[i], s_in[i], Rho, comp, 1, 0);
+                    }
+                }
+                break;
+
+            case PlotVar_Hext:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], get_rho_Hext()[i], 0, 0, 1, 0);
+                    MultiFab::Divide(mf[i], s_in[i], Rho, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_Hnuc:
+                get_rho_Hext();
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], rho_Hnuc[i], 0, 0, 1, 0);
+                    MultiFab::Divide(mf[i], s_in[i], Rho, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_eta_rho:
+                Put1dArrayOnCart(etarho_cc, mf, true, false, bcs_u, 0, 1);
+                break;
+
+            case PlotVar_tfromp:
+                set_temp(temp_from_p);
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], Temp, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_tfromh:
+                set_temp(temp_from_h);
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], Temp, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_deltap:
+                // the temperature is the initial guess of the EOS
+                set_temp(temp_from_h);
+                PfromRhoH(s_in, s_in, mf);
+                for (int i = 0; i <= finest_level; ++i) {
+                    Combine1dArrayWithCart(i, p0_in, mf[i], 0,
+                                           BaseStateOp::Subtract);
+                }
+                break;
+
+            case PlotVar_deltaT:
+                // deltaT = (tfromp - tfromh) / tfromh
+                set_temp(temp_from_p);
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], Temp, 0, 1, 0);
+                }
+                set_temp(temp_from_h);
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Subtract(mf[i], s_in[i], Temp, 0, 1, 0);
+                    MultiFab::Divide(mf[i], s_in[i], Temp, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_Pi:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], Pi, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_pioverp0:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], Pi, 0, 1, 0);
+                    Combine1dArrayWithCart(i, p0_in, mf[i], 0,
+                                           BaseStateOp::Divide);
+                }
+                break;
+
+            case PlotVar_p0pluspi:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], Pi, 0, 1, 0);
+                    Combine1dArrayWithCart(i, p0_in, mf[i], 0,
+                                           BaseStateOp::Add);
+                }
+                break;
+
+            case PlotVar_gpi:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], gpi[i], 0, 0, AMREX_SPACEDIM, 0);
+                }
+                break;
+
+            case PlotVar_rhopert:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], Rho, 0, 1, 0);
+                    Combine1dArrayWithCart(i, rho0_in, mf[i], 0,
+                                           BaseStateOp::Subtract);
+                }
+                break;
+
+            case PlotVar_rhohpert:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], RhoH, 0, 1, 0);
+                    Combine1dArrayWithCart(i, rhoh0_in, mf[i], 0,
+                                           BaseStateOp::Subtract);
+                }
+                break;
+
+            case PlotVar_tpert: {
+                set_final_temp();
+
+                Vector<MultiFab> tempbar_cart;
+                define_mf(tempbar_cart, 1, 0);
+                Average(s_in, tempbar_plot, Temp);
+                Put1dArrayOnCart(tempbar_plot, tempbar_cart, false, false,
+                                 bcs_f, 0);
+
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], s_in[i], Temp, 0, 1, 0);
+                    MultiFab::Subtract(mf[i], tempbar_cart[i], 0, 0, 1, 0);
+                }
+                break;
+            }
+
+            case PlotVar_rho0:
+                for (int i = 0; i <= finest_level; ++i) {
+                    Combine1dArrayWithCart(i, rho0_in, mf[i], 0,
+                                           BaseStateOp::Copy);
+                }
+                break;
+
+            case PlotVar_rhoh0:
+                for (int i = 0; i <= finest_level; ++i) {
+                    Combine1dArrayWithCart(i, rhoh0_in, mf[i], 0,
+                                           BaseStateOp::Copy);
+                }
+                break;
+
+            case PlotVar_h0: {
+                Vector<MultiFab> rho0_cart;
+                define_mf(rho0_cart, 1, 0);
+
+                for (int i = 0; i <= finest_level; ++i) {
+                    Combine1dArrayWithCart(i, rhoh0_in, mf[i], 0,
+                                           BaseStateOp::Copy);
+                    Combine1dArrayWithCart(i, rho0_in, rho0_cart[i], 0,
+                                           BaseStateOp::Copy);
+
+                    // we have to use protected_divide here to guard against
+                    // division by zero in the case that there are zeros rho0
+                    for (MFIter mfi(mf[i]); mfi.isValid(); ++mfi) {
+                        mf[i][mfi].protected_divide<RunOn::Device>(
+                            rho0_cart[i][mfi], 0, 0);
+                    }
+                }
+                break;
+            }
+
+            case PlotVar_p0:
+                for (int i = 0; i <= finest_level; ++i) {
+                    Combine1dArrayWithCart(i, p0_in, mf[i], 0,
+                                           BaseStateOp::Copy);
+                }
+                break;
+
+            case PlotVar_MachNumber:
+                set_final_temp();
+                MachfromRhoH(s_in, u_in, p0_in, get_w0r_cart(), mf);
+                break;
+
+            case PlotVar_deltagamma:
+                set_final_temp();
+                MakeDeltaGamma(s_in, p0_in, gamma1bar_in, mf);
+                break;
+
+            case PlotVar_entropy:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], get_entropy()[i], 0, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_entropypert: {
+                // entropypert = (entropy - entropybar) / entropybar
+                Vector<MultiFab> entropybar_cart;
+                define_mf(entropybar_cart, 1, 0);
+                Average(get_entropy(), tempbar_plot, 0);
+                Put1dArrayOnCart(tempbar_plot, entropybar_cart, false, false,
+                                 bcs_f, 0);
+
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], entropy[i], 0, 0, 1, 0);
+                    MultiFab::Subtract(mf[i], entropybar_cart[i], 0, 0, 1, 0);
+                    MultiFab::Divide(mf[i], entropybar_cart[i], 0, 0, 1, 0);
+                }
+                break;
+            }
+
+            case PlotVar_pi_divu:
+                MakePiDivu(u_in, s_in, mf);
+                break;
+
+            case PlotVar_processor_number:
+                // processor number of each tile
+                for (int i = 0; i <= finest_level; ++i) {
+                    mf[i].setVal(ParallelDescriptor::MyProc());
+                }
+                break;
+
+            case PlotVar_ad_excess:
+                set_final_temp();
+                MakeAdExcess(s_in, mf);
+                break;
+
+            case PlotVar_S:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], S_cc_in[i], 0, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_soundspeed:
+                set_final_temp();
+                CsfromRhoH(s_in, p0_in, mf);
+                break;
+
+            case PlotVar_maggrav:
+                MakeGrav(rho0_new, mf);
+                break;
+
+            case PlotVar_w0:
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], w0_cart[i], 0, 0, AMREX_SPACEDIM, 0);
+                }
+                break;
+
+            case PlotVar_divw0:
+                get_w0r_cart();
+                MakeDivw0(w0mac, mf);
+                break;
+
+            case PlotVar_thermal:
+                get_thermal();
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], thermal[i], 0, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_conductivity:
+                get_thermal();
+                for (int i = 0; i <= finest_level; ++i) {
+                    mf[i].setVal(0.);
+                    MultiFab::Subtract(mf[i], Tcoeff[i], 0, 0, 1, 0);
+                }
+                break;
+
+            case PlotVar_velrc: {
+                // radial and circular velocities
+                Vector<MultiFab> rad_vel;
+                Vector<MultiFab> circ_vel;
+                define_mf(rad_vel, 1, 0);
+                define_mf(circ_vel, 1, 0);
+                MakeVelrc(u_in, get_w0r_cart(), rad_vel, circ_vel);
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], rad_vel[i], 0, 0, 1, 0);
+                    MultiFab::Copy(mf[i], circ_vel[i], 0, 1, 1, 0);
+                }
+                break;
+            }
+
+            case PlotVar_sponge: {
+                Vector<MultiFab> sponge;
+                define_mf(sponge, 1, 0);
+                SpongeInit(rho0_old);
+                MakeSponge(sponge);
+
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], sponge[i], 0, 0, 1, 0);
+
+                    if (plot_sponge_fdamp) {
+                        // compute f_damp assuming sponge=1/(1+dt*kappa*fdamp)
+                        // therefore fdamp = (1/sponge-1)/(dt*kappa)
+                        mf[i].invert(1., 0, 1);
+                        mf[i].plus(-1., 0, 1);
+                        mf[i].mult(1. / (dt * sponge_kappa), 0, 1);
+                    }
+                }
+                break;
+            }
+
+            case PlotVar_burn_stats:
+                // integration statistics of the last burn
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(mf[i], burn_stats[i], 0, 0, 4, 0);
+                }
+                break;
+        }
+
+        for (const auto& comp : comps) {
+            for (int i = 0; i <= finest_level; ++i) {
+                plot_mf_data[i]->copy(mf[i], comp.first, comp.second, 1);
+            }
+        }
+    }
+
+    // leave s_in with the temperature MAESTRO uses if it was changed
+    if (temp_source != temp_in) {
+        set_final_temp();
+    }
+
+    // add plot_mf_data[i] to plot_mf
+    for (int i = 0; i <= finest_level; ++i) {
+        plot_mf.push_back(plot_mf_data[i]);
+    }
+
+    return plot_mf;
+}
+
+// the plot variables, in plotfile order.  Only the variables enabled by the
+// runtime parameters are listed.
+Vector<Maestro::PlotVar> Maestro::PlotVarRegistry() const {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::PlotVarRegistry()", PlotVarRegistry);
+
+    // the components of a vector, e.g., velx, vely, velz
+    const auto vector_names = [](const std::string& base) {
+        Vector<std::string> names;
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            std::string x = base;
+            x += (120 + i);
+            names.push_back(x);
+        }
+        return names;
+    };
+
+    // one component per species, e.g., X(he4)
+    const auto spec_names = [](const std::string& base) {
+        Vector<std::string> names;
+        for (int i = 0; i < NumSpec; i++) {
+            std::string spec_string = base + "(";
+            spec_string += short_spec_names_cxx[i];
+            spec_string += ')';
+            names.push_back(spec_string);
+        }
+        return names;
+    };
+
+    Vector<PlotVar> vars;
+
+    vars.push_back({PlotVar_vel, vector_names("vel")});
+    vars.push_back({PlotVar_magvel, {"magvel"}});
+    vars.push_back({PlotVar_momentum, {"momentum"}});
+    vars.push_back({PlotVar_vort, {"vort"}});
+
+    // density and enthalpy
+    vars.push_back({PlotVar_rho, {"rho"}});
+    vars.push_back({PlotVar_rhoh, {"rhoh"}});
+    vars.push_back({PlotVar_h, {"h"}});
+    vars.push_back({PlotVar_rhoX, spec_names("rhoX")});
+
+    if (plot_spec) {
+        vars.push_back({PlotVar_X, spec_names("X")});
+        vars.push_back({PlotVar_abar, {"abar"}});
+    }
+    if (plot_spec || plot_omegadot) {
+        vars.push_back({PlotVar_omegadot, spec_names("omegadot")});
+    }
+    if (plot_Hext) {
+        vars.push_back({PlotVar_Hext, {"Hext"}});
+    }
+    if (plot_Hnuc) {
+        vars.push_back({PlotVar_Hnuc, {"Hnuc"}});
+    }
+    if (plot_eta) {
+        vars.push_back({PlotVar_eta_rho, {"eta_rho"}});
+    }
+
+    vars.push_back({PlotVar_tfromp, {"tfromp"}});
+    vars.push_back({PlotVar_tfromh, {"tfromh"}});
+    vars.push_back({PlotVar_deltap, {"deltap"}});
+    vars.push_back({PlotVar_deltaT, {"deltaT"}});
+    vars.push_back({PlotVar_Pi, {"Pi"}});
+    vars.push_back({PlotVar_pioverp0, {"pioverp0"}});
+    vars.push_back({PlotVar_p0pluspi, {"p0pluspi"}});
+
+    if (plot_gpi) {
+        vars.push_back({PlotVar_gpi, vector_names("gpi")});
+    }
+
+    vars.push_back({PlotVar_rhopert, {"rhopert"}});
+    vars.push_back({PlotVar_rhohpert, {"rhohpert"}});
+    vars.push_back({PlotVar_tpert, {"tpert"}});
+
+    if (plot_base_state) {
+        vars.push_back({PlotVar_rho0, {"rho0"}});
+        vars.push_back({PlotVar_rhoh0, {"rhoh0"}});
+        vars.push_back({PlotVar_h0, {"h0"}});
+        vars.push_back({PlotVar_p0, {"p0"}});
+    }
+
+    vars.push_back({PlotVar_MachNumber, {"MachNumber"}});
+    vars.push_back({PlotVar_deltagamma, {"deltagamma"}});
+    vars.push_back({PlotVar_entropy, {"entropy"}});
+    vars.push_back({PlotVar_entropypert, {"entropypert"}});
+
+    if (plot_pidivu) {
+        vars.push_back({PlotVar_pi_divu, {"pi_divu"}});
+    }
+    if (plot_processors) {
+        vars.push_back({PlotVar_processor_number, {"processor_number"}});
+    }
+    if (plot_ad_excess) {
+        vars.push_back({PlotVar_ad_excess, {"ad_excess"}});
+    }
+
+    vars.push_back({PlotVar_S, {"S"}});
+
+    if (plot_cs) {
+        vars.push_back({PlotVar_soundspeed, {"soundspeed"}});
+    }
+    if (plot_grav) {
+        vars.push_back({PlotVar_maggrav, {"maggrav"}});
+    }
+    if (plot_base_state) {
+        vars.push_back({PlotVar_w0, vector_names("w0")});
+        vars.push_back({PlotVar_divw0, {"divw0"}});
+    }
+
+    vars.push_back({PlotVar_thermal, {"thermal"}});
+    vars.push_back({PlotVar_conductivity, {"conductivity"}});
+
+    if (spherical) {
+        vars.push_back({PlotVar_velrc, {"radial_velocity", "circ_velocity"}});
+    }
+    if (do_sponge) {
+        vars.push_back({PlotVar_sponge, {plot_sponge_fdamp ? "sponge_fdamp"
+                                                           : "sponge"}});
+    }
+    if (do_burn_stats && plot_burn_stats) {
+        vars.push_back({PlotVar_burn_stats,
+                        {"burn_nsteps", "burn_nrhs", "burn_njac",
+                         "burn_failed"}});
+    }
+
+    return vars;
+}
+
+void Maestro::MakeMagvel(const Vector<MultiFab>& vel,
+                         Vector<MultiFab>& magvel) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeMagvel()", MakeMagvel);
+
+#if (AMREX_SPACEDIM == 3)
+
+    Vector<std::array<MultiFab, AMREX_SPACEDIM> > w0mac(finest_level + 1);
+
+    if (spherical) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            w0mac[lev][0].define(convert(grids[lev], nodal_flag_x), dmap[lev],
+                                 1, 1);
+            w0mac[lev][1].define(convert(grids[lev], nodal_flag_y), dmap[lev],
+                                 1, 1);
+            w0mac[lev][2].define(convert(grids[lev], nodal_flag_z), dmap[lev],
+                                 1, 1);
+        }
+        MakeW0mac(w0mac);
+    }
+#endif
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+        if (!spherical) {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for (MFIter mfi(vel[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+                // Get the index space of the valid region
+                const Box& tileBox = mfi.tilebox();
+
+                const Array4<const Real> vel_arr = vel[lev].array(mfi);
+                const Array4<const Real> w0_arr = w0_cart[lev].array(mfi);
+                const Array4<Real> magvel_arr = magvel[lev].array(mfi);
+
+                ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+#if (AMREX_SPACEDIM == 2)
+                    Real v_total =
+                        vel_arr(i, j, k, 1) +
+                        0.5 * (w0_arr(i, j, k, 1) + w0_arr(i, j + 1, k, 1));
+                    magvel_arr(i, j, k) =
+                        sqrt(vel_arr(i, j, k, 0) * vel_arr(i, j, k, 0) +
+                             v_total * v_total);
+#else
+                    Real w_total = vel_arr(i,j,k,2) + 0.5 * (w0_arr(i,j,k,2) + w0_arr(i,j,k+1,2));
+                    magvel_arr(i,j,k) = sqrt(vel_arr(i,j,k,0)*vel_arr(i,j,k,0) + 
+                        vel_arr(i,j,k,1)*vel_arr(i,j,k,1) + 
+                        w_total*w_total);
+#endif
+                });
+            }
+        } else {
+#if (AMREX_SPACEDIM == 3)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for (MFIter mfi(vel[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+                // Get the index space of the valid region
+                const Box& tileBox = mfi.tilebox();
+
+                const Array4<const Real> vel_arr = vel[lev].array(mfi);
+                const Array4<const Real> w0macx = w0mac[lev][0].array(mfi);
+                const Array4<const Real> w0macy = w0mac[lev][1].array(mfi);
+                const Array4<const Real> w0macz = w0mac[lev][2].array(mfi);
+                const Array4<Real> magvel_arr = magvel[lev].array(mfi);
+
+                ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                    Real u_total =
+                        vel_arr(i, j, k, 0) +
+                        0.5 * (w0macx(i, j, k) + w0macx(i + 1, j, k));
+                    Real v_total =
+                        vel_arr(i, j, k, 1) +
+                        0.5 * (w0macy(i, j, k) + w0macy(i, j + 1, k));
+                    Real w_total =
+                        vel_arr(i, j, k, 2) +
+                        0.5 * (w0macz(i, j, k) + w0macz(i, j, k + 1));
+                    magvel_arr(i, j, k) =
+                        sqrt(u_total * u_total + v_total * v_total +
+                             w_total * w_total);
+                });
+            }
+#endif
+        }
+    }
+
+    // average down and fill ghost cells
+    AverageDown(magvel, 0, 1);
+    FillPatch(t_old, magvel, magvel, magvel, 0, 0, 1, 0, bcs_f);
+}
+
+void Maestro::MakeVelrc(const Vector<MultiFab>& vel,
+                        const Vector<MultiFab>& w0rcart,
+                        Vector<MultiFab>& rad_vel, Vector<MultiFab>& circ_vel) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeVelrc()", MakeVelrc);
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(vel[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            // Get the index space of the valid region
+            const Box& tileBox = mfi.tilebox();
+
+            const Array4<const Real> vel_arr = vel[lev].array(mfi);
+            const Array4<Real> radvel_arr = rad_vel[lev].array(mfi);
+            const Array4<Real> circvel_arr = circ_vel[lev].array(mfi);
+            const Array4<const Real> w0rcart_arr = w0rcart[lev].array(mfi);
+            const Array4<const Real> normal_arr = normal[lev].array(mfi);
+
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                circvel_arr(i, j, k) = 0.0;
+                radvel_arr(i, j, k) = 0.0;
+
+                for (auto n = 0; n < AMREX_SPACEDIM; ++n) {
+                    radvel_arr(i, j, k) +=
+                        vel_arr(i, j, k, n) * normal_arr(i, j, k, n);
+                }
+
+                for (auto n = 0; n < AMREX_SPACEDIM; ++n) {
+                    Real circ_comp =
+                        vel_arr(i, j, k, n) -
+                        radvel_arr(i, j, k) * normal_arr(i, j, k, n);
+                    circvel_arr(i, j, k) += circ_comp * circ_comp;
+                }
+
+                circvel_arr(i, j, k) = sqrt(circvel_arr(i, j, k));
+
+                // add base state vel to get full radial velocity
+                radvel_arr(i, j, k) += w0rcart_arr(i, j, k);
+            });
+        }
+    }
+
+    // average down and fill ghost cells
+    AverageDown(rad_vel, 0, 1);
+    FillPatch(t_old, rad_vel, rad_vel, rad_vel, 0, 0, 1, 0, bcs_f);
+    AverageDown(circ_vel, 0, 1);
+    FillPatch(t_old, circ_vel, circ_vel, circ_vel, 0, 0, 1, 0, bcs_f);
+}
+
+void Maestro::MakeAdExcess(const Vector<MultiFab>& state,
+                           Vector<MultiFab>& ad_excess) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeAdExcess()", MakeAdExcess);
+
+    const auto base_cutoff_density_loc = base_cutoff_density;
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // create MultiFabs to hold pressure and gradient
+        MultiFab pres_mf(grids[lev], dmap[lev], 1, 0);
+        MultiFab nabla_ad_mf(grids[lev], dmap[lev], 1, 0);
+
+        // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(state[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            // Get the index space of the valid region
+            const Box& tileBox = mfi.tilebox();
+
+            const Array4<const Real> state_arr = state[lev].array(mfi);
+            const Array4<Real> ad_excess_arr = ad_excess[lev].array(mfi);
+            const Array4<Real> pres = pres_mf.array(mfi);
+            const Array4<Real> nabla_ad = nabla_ad_mf.array(mfi);
+#if (AMREX_SPACEDIM == 3)
+            const Array4<const Real> normal_arr = normal[lev].array(mfi);
+#endif
+
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                eos_t eos_state;
+
+                eos_state.rho = state_arr(i, j, k, Rho);
+                eos_state.T = state_arr(i, j, k, Temp);
+                for (auto comp = 0; comp < NumSpec; ++comp) {
+                    eos_state.xn[comp] =
+                        state_arr(i, j, k, FirstSpec + comp) / eos_state.rho;
+                }
+#if NAUX_NET > 0
+                for (auto comp = 0; comp < NumAux; ++comp) {
+                    eos_state.aux[comp] =
+                        state_arr(i, j, k, FirstAux + comp) / eos_state.rho;
+                }
+#endif
+
+                eos(eos_input_rt, eos_state);
+
+                pres(i, j, k) = eos_state.p;
+                // Print() << "pres = " << pres(i,j,k) << std::endl;
+
+                Real chi_rho = eos_state.rho * eos_state.dpdr / eos_state.p;
+                Real chi_t = eos_state.T * eos_state.dpdT / eos_state.p;
+                nabla_ad(i, j, k) =
+                    (eos_state.gam1 - chi_rho) / (chi_t * eos_state.gam1);
+            });
+
+            const auto lo = tileBox.loVect3d();
+            const auto hi = tileBox.hiVect3d();
+
+            if (!spherical) {
+                ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                    Real nabla = 0.0;
+
+                    if (state_arr(i, j, k, Rho) > base_cutoff_density_loc) {
+                        Real dtemp = 0.0;
+                        Real dp = 0.0;
+#if (AMREX_SPACEDIM == 2)
+                        // forward difference
+                        if (j == lo[1]) {
+                            dtemp = state_arr(i, j + 1, k, Temp) -
+                                    state_arr(i, j, k, Temp);
+                            dp = pres(i, j + 1, k) - pres(i, j, k);
+                            // backward difference
+                        } else if (j == hi[1]) {
+                            dtemp = state_arr(i, j, k, Temp) -
+                                    state_arr(i, j - 1, k, Temp);
+                            dp = pres(i, j, k) - pres(i, j - 1, k);
+                            // centered difference
+                        } else {
+                            dtemp = state_arr(i, j + 1, k, Temp) -
+                                    state_arr(i, j - 1, k, Temp);
+                            dp = pres(i, j + 1, k) - pres(i, j - 1, k);
+                        }
+#else 
+                        // forward difference
+                        if (k == lo[2]) {
+                            dtemp = state_arr(i,j,k+1,Temp) - state_arr(i,j,k,Temp);
+                            dp = pres(i,j,k+1) - pres(i,j,k);
+                        // backward difference
+                        } else if (k == hi[2]) {
+                            dtemp = state_arr(i,j,k,Temp) - state_arr(i,j,k-1,Temp);
+                            dp = pres(i,j,k) - pres(i,j,k-1);
+                        // centered difference
+                        } else {
+                            dtemp = state_arr(i,j,k+1,Temp) - state_arr(i,j,k-1,Temp);
+                            dp = pres(i,j,k+1) - pres(i,j,k-1);
+                        }
+#endif
+                        // prevent Inf
+                        if (dp * state_arr(i, j, k, Temp) == 0.0) {
+                            nabla = std::numeric_limits<Real>::min();
+                        } else {
+                            nabla = pres(i, j, k) * dtemp /
+                                    (dp * state_arr(i, j, k, Temp));
+                        }
+                    }
+
+                    ad_excess_arr(i, j, k) = nabla - nabla_ad(i, j, k);
+                });
+            } else {
+#if (AMREX_SPACEDIM == 3)
+                RealVector dtemp_vec(AMREX_SPACEDIM, 0.0);
+                RealVector dp_vec(AMREX_SPACEDIM, 0.0);
+
+                Real* AMREX_RESTRICT dtemp = dtemp_vec.dataPtr();
+                Real* AMREX_RESTRICT dp = dp_vec.dataPtr();
+
+                ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                    Real nabla = 0.0;
+
+                    if (state_arr(i, j, k, Rho) > base_cutoff_density_loc) {
+                        // compute gradient
+                        // forward difference
+                        if (i == lo[0]) {
+                            dtemp[0] = state_arr(i + 1, j, k, Temp) -
+                                       state_arr(i, j, k, Temp);
+                            dp[0] = pres(i + 1, j, k) - pres(i, j, k);
+                            // backward difference
+                        } else if (i == hi[0]) {
+                            dtemp[0] = state_arr(i, j, k, Temp) -
+                                       state_arr(i - 1, j, k, Temp);
+                            dp[0] = pres(i, j, k) - pres(i - 1, j, k);
+                            // centered difference
+                        } else {
+                            dtemp[0] = state_arr(i + 1, j, k, Temp) -
+                                       state_arr(i - 1, j, k, Temp);
+                            dp[0] = pres(i + 1, j, k) - pres(i - 1, j, k);
+                        }
+                        // forward difference
+                        if (j == lo[1]) {
+                            dtemp[1] = state_arr(i, j + 1, k, Temp) -
+                                       state_arr(i, j, k, Temp);
+                            dp[1] = pres(i, j + 1, k) - pres(i, j, k);
+                            // backward difference
+                        } else if (j == hi[1]) {
+                            dtemp[1] = state_arr(i, j, k, Temp) -
+                                       state_arr(i, j - 1, k, Temp);
+                            dp[1] = pres(i, j, k) - pres(i, j - 1, k);
+                            // centered difference
+                        } else {
+                            dtemp[1] = state_arr(i, j + 1, k, Temp) -
+                                       state_arr(i, j - 1, k, Temp);
+                            dp[1] = pres(i, j + 1, k) - pres(i, j - 1, k);
+                        }
+                        // forward difference
+                        if (k == lo[2]) {
+                            dtemp[2] = state_arr(i, j, k + 1, Temp) -
+                                       state_arr(i, j, k, Temp);
+                            dp[2] = pres(i, j, k + 1) - pres(i, j, k);
+                            // backward difference
+                        } else if (k == hi[2]) {
+                            dtemp[2] = state_arr(i, j, k, Temp) -
+                                       state_arr(i, j, k - 1, Temp);
+                            dp[2] = pres(i, j, k) - pres(i, j, k - 1);
+                            // centered difference
+                        } else {
+                            dtemp[2] = state_arr(i, j, k + 1, Temp) -
+                                       state_arr(i, j, k - 1, Temp);
+                            dp[2] = pres(i, j, k + 1) - pres(i, j, k - 1);
+                        }
+
+                        Real dp_dot = 0.0;
+                        Real dtemp_dot = 0.0;
+                        for (auto c = 0; c < AMREX_SPACEDIM; ++c) {
+                            dp_dot += dp[c] * normal_arr(i, j, k, c);
+                            dtemp_dot += dtemp[c] * normal_arr(i, j, k, c);
+                        }
+
+                        // prevent Inf
+                        if (dp_dot * state_arr(i, j, k, Temp) == 0.0) {
+                            nabla = std::numeric_limits<Real>::min();
+                        } else {
+                            nabla = pres(i, j, k) * dtemp_dot /
+                                    (dp_dot * state_arr(i, j, k, Temp));
+                        }
+                    }
+
+                    ad_excess_arr(i, j, k) = nabla - nabla_ad(i, j, k);
+                });
+#endif
+            }
+        }
+    }
+
+    // average down and fill ghost cells
+    AverageDown(ad_excess, 0, 1);
+    FillPatch(t_old, ad_excess, ad_excess, ad_excess, 0, 0, 1, 0, bcs_f);
+}
+
+void Maestro::MakeGrav(const BaseState<Real>& rho0, Vector<MultiFab>& grav) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeGrav()", MakeGrav);
+
+    BaseState<Real> grav_cell(base_geom.max_radial_level + 1,
+                              base_geom.nr_fine);
+
+    MakeGravCell(grav_cell, rho0);
+
+    Put1dArrayOnCart(grav_cell, grav, false, false, bcs_f, 0);
+
+    // average down and fill ghost cells
+    AverageDown(grav, 0, 1);
+    FillPatch(t_old, grav, grav, grav, 0, 0, 1, 0, bcs_f);
+}
+
+void Maestro::MakeVorticity(const Vector<MultiFab>& vel,
+                            Vector<MultiFab>& vorticity) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeVorticity()", MakeVorticity);
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // get references to the MultiFabs at level lev
+        const MultiFab& vel_mf = vel[lev];
+
+        const Real* dx = geom[lev].CellSize();
+        const Box& domainBox = geom[lev].Domain();
+
+        const Real hx = dx[0];
+        const Real hy = dx[1];
+#if (AMREX_SPACEDIM == 3)
+        const Real hz = dx[2];
+#endif
+        const int ilo = domainBox.loVect()[0];
+        const int ihi = domainBox.hiVect()[0];
+        const int jlo = domainBox.loVect()[1];
+        const int jhi = domainBox.hiVect()[1];
+#if (AMREX_SPACEDIM == 3)
+        const int klo = domainBox.loVect()[2];
+        const int khi = domainBox.hiVect()[2];
+#endif
+
+        // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(vel_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            // Get the index space of the valid region
+            const Box& tileBox = mfi.tilebox();
+
+            Array4<const Real> const u = vel[lev].array(mfi);
+            Array4<Real> const vort = vorticity[lev].array(mfi);
+            GpuArray<int, AMREX_SPACEDIM * 2> physbc;
+            for (int n = 0; n < AMREX_SPACEDIM * 2; ++n) {
+                physbc[n] = phys_bc[n];
+            }
+
+#if (AMREX_SPACEDIM == 2)
+
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                Real vx = 0.5 * (u(i + 1, j, k, 1) - u(i - 1, j, k, 1)) / hx;
+                Real uy = 0.5 * (u(i, j + 1, k, 0) - u(i, j - 1, k, 0)) / hy;
+
+                if (i == ilo && (physbc[0] == Inflow || physbc[0] == SlipWall ||
+                                 physbc[0] == NoSlipWall)) {
+                    vx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         hx;
+                    uy = 0.5 * (u(i, j + 1, k, 0) - u(i, j - 1, k, 0)) / hy;
+
+                } else if (i == ihi + 1 &&
+                           (physbc[AMREX_SPACEDIM] == Inflow ||
+                            physbc[AMREX_SPACEDIM] == SlipWall ||
+                            physbc[AMREX_SPACEDIM] == NoSlipWall)) {
+                    vx = -(u(i - 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i + 1, j, k, 1)) /
+                         hx;
+                    uy = 0.5 * (u(i, j + 1, k, 0) - u(i, j - 1, k, 0)) / hy;
+                }
+
+                if (j == jlo && (physbc[1] == Inflow || physbc[1] == SlipWall ||
+                                 physbc[1] == NoSlipWall)) {
+                    vx = 0.5 * (u(i + 1, j, k, 1) - u(i - 1, j, k, 0)) / hx;
+                    uy = (u(i, j + 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j - 1, k, 0)) /
+                         hy;
+
+                } else if (j == jhi + 1 &&
+                           (physbc[AMREX_SPACEDIM + 1] == Inflow ||
+                            physbc[AMREX_SPACEDIM + 1] == SlipWall ||
+                            physbc[AMREX_SPACEDIM + 1] == NoSlipWall)) {
+                    vx = 0.5 * (u(i + 1, j, k, 1) - u(i - 1, j, k, 1)) / hx;
+                    uy = -(u(i, j - 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j + 1, k, 0)) /
+                         hy;
+                }
+
+                vort(i, j, k) = vx - uy;
+            });
+
+#else
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                Real uy = 0.5 * (u(i, j + 1, k, 0) - u(i, j - 1, k, 0)) / hy;
+                Real uz = 0.5 * (u(i, j, k + 1, 0) - u(i, j, k - 1, 0)) / hz;
+                Real vx = 0.5 * (u(i + 1, j, k, 1) - u(i - 1, j, k, 1)) / hx;
+                Real vz = 0.5 * (u(i, j, k + 1, 1) - u(i, j, k - 1, 1)) / hz;
+                Real wx = 0.5 * (u(i + 1, j, k, 2) - u(i - 1, j, k, 2)) / hx;
+                Real wy = 0.5 * (u(i, j + 1, k, 2) - u(i, j - 1, k, 2)) / hy;
+
+                bool fix_lo_x =
+                    (physbc[0] == Inflow || physbc[0] == NoSlipWall);
+                bool fix_hi_x = (physbc[AMREX_SPACEDIM] == Inflow ||
+                                 physbc[AMREX_SPACEDIM] == NoSlipWall);
+
+                bool fix_lo_y =
+                    (physbc[1] == Inflow || physbc[1] == NoSlipWall);
+                bool fix_hi_y = (physbc[AMREX_SPACEDIM + 1] == Inflow ||
+                                 physbc[AMREX_SPACEDIM + 1] == NoSlipWall);
+
+                bool fix_lo_z =
+                    (physbc[2] == Inflow || physbc[2] == NoSlipWall);
+                bool fix_hi_z = (physbc[AMREX_SPACEDIM + 2] == Inflow ||
+                                 physbc[AMREX_SPACEDIM + 2] == NoSlipWall);
+
+                // First do all the faces
+                if (fix_lo_x && i == ilo) {
+                    vx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                } else if (fix_hi_x && i == ihi + 1) {
+                    vx = -(u(i - 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i + 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = -(u(i - 1, j, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i + 1, j, k, 2)) /
+                         (3.0 * hx);
+                }
+
+                if (fix_lo_y && j == jlo) {
+                    uy = (u(i, j + 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j - 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = (u(i, j + 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                          4.0 * u(i, j - 1, k, 2)) /
+                         (3.0 * hy);
+                } else if (fix_hi_y && j == jhi + 1) {
+                    uy = -(u(i, j - 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j + 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = -(u(i, j - 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i, j + 1, k, 2)) /
+                         (3.0 * hy);
+                }
+
+                if (fix_lo_z && k == klo) {
+                    uz = (u(i, j, k + 1, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j, k - 1, 0)) /
+                         (3.0 * hz);
+                    vz = (u(i, j, k + 1, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i, j, k - 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_hi_z && k == khi + 1) {
+                    uz = -(u(i, j, k - 1, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j, k + 1, 0)) /
+                         (3.0 * hz);
+                    vz = -(u(i, j, k - 1, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i, j, k + 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                // Next do all the edges
+                if (fix_lo_x && fix_lo_y && i == ilo && j == jlo) {
+                    vx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    uy = (u(i, j + 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j - 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = (u(i, j + 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                          4.0 * u(i, j - 1, k, 2)) /
+                         (3.0 * hy);
+                }
+
+                if (fix_hi_x && fix_lo_y && i == ihi + 1 && j == jlo) {
+                    vx = -(u(i - 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i + 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = -(u(i - 1, j, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i + 1, j, k, 2)) /
+                         (3.0 * hx);
+                    uy = (u(i, j + 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j - 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = (u(i, j + 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                          4.0 * u(i, j - 1, k, 2)) /
+                         (3.0 * hy);
+                }
+
+                if (fix_lo_x && fix_hi_y && i == ilo && j == jhi + 1) {
+                    vx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    uy = -(u(i, j - 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j + 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = -(u(i, j - 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i, j + 1, k, 2)) /
+                         (3.0 * hy);
+                }
+
+                if (fix_lo_x && fix_lo_z && i == ilo && k == klo) {
+                    vx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    uz = (u(i, j, k + 1, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j, k - 1, 0)) /
+                         (3.0 * hz);
+                    vz = (u(i, j, k + 1, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i, j, k - 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_hi_x && fix_lo_z && i == ihi + 1 && k == klo) {
+                    vx = -(u(i - 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i + 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = -(u(i - 1, j, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i + 1, j, k, 2)) /
+                         (3.0 * hx);
+                    uz = (u(i, j, k + 1, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j, k - 1, 0)) /
+                         (3.0 * hz);
+                    vz = (u(i, j, k + 1, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i, j, k - 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_lo_x && fix_hi_z && i == ilo && k == khi + 1) {
+                    vx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    uz = -(u(i, j, k - 1, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j, k + 1, 0)) /
+                         (3.0 * hz);
+                    vz = -(u(i, j, k - 1, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i, j, k + 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_hi_x && fix_hi_z && i == ihi + 1 && k == khi + 1) {
+                    vx = -(u(i - 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i + 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = -(u(i - 1, j, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i + 1, j, k, 2)) /
+                         (3.0 * hx);
+                    uz = -(u(i, j, k - 1, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j, k + 1, 0)) /
+                         (3.0 * hz);
+                    vz = -(u(i, j, k - 1, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i, j, k + 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_lo_y && fix_lo_z && j == jlo && k == klo) {
+                    uy = (u(i, j + 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j - 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = (u(i, j + 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                          4.0 * u(i, j - 1, k, 2)) /
+                         (3.0 * hy);
+                    uz = (u(i, j, k + 1, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j, k - 1, 0)) /
+                         (3.0 * hz);
+                    vz = (u(i, j, k + 1, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i, j, k - 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_hi_y && fix_lo_z && j == jhi + 1 && k == klo) {
+                    uy = -(u(i, j - 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j + 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = -(u(i, j - 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i, j + 1, k, 2)) /
+                         (3.0 * hy);
+                    uz = (u(i, j, k + 1, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j, k - 1, 0)) /
+                         (3.0 * hz);
+                    vz = (u(i, j, k + 1, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i, j, k - 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_lo_y && fix_hi_z && j == jlo && k == khi + 1) {
+                    uy = (u(i, j + 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j - 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = (u(i, j + 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                          4.0 * u(i, j - 1, k, 2)) /
+                         (3.0 * hy);
+                    uz = -(u(i, j, k - 1, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j, k + 1, 0)) /
+                         (3.0 * hz);
+                    vz = -(u(i, j, k - 1, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i, j, k + 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_hi_y && fix_hi_z && j == jhi + 1 && k == khi + 1) {
+                    uy = -(u(i, j - 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j + 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = -(u(i, j - 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i, j + 1, k, 2)) /
+                         (3.0 * hy);
+                    uz = -(u(i, j, k - 1, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j, k + 1, 0)) /
+                         (3.0 * hz);
+                    vz = -(u(i, j, k - 1, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i, j, k + 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                // Finally do all the corners
+                if (fix_lo_x && fix_lo_y && fix_lo_z && i == ilo && j == jlo &&
+                    k == klo) {
+                    vx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    uy = (u(i, j + 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j - 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = (u(i, j + 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                          4.0 * u(i, j - 1, k, 2)) /
+                         (3.0 * hy);
+                    uz = (u(i, j, k + 1, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j, k - 1, 0)) /
+                         (3.0 * hz);
+                    vz = (u(i, j, k + 1, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i, j, k - 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_hi_x && fix_lo_y && fix_lo_z && i == ihi + 1 &&
+                    j == jlo && k == klo) {
+                    vx = -(u(i - 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i + 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = -(u(i - 1, j, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i + 1, j, k, 2)) /
+                         (3.0 * hx);
+                    uy = (u(i, j + 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j - 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = (u(i, j + 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                          4.0 * u(i, j - 1, k, 2)) /
+                         (3.0 * hy);
+                    uz = (u(i, j, k + 1, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j, k - 1, 0)) /
+                         (3.0 * hz);
+                    vz = (u(i, j, k + 1, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i, j, k - 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_lo_x && fix_hi_y && fix_lo_z && i == ilo &&
+                    j == jhi + 1 && k == klo) {
+                    vx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    uy = -(u(i, j - 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j + 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = -(u(i, j - 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i, j + 1, k, 2)) /
+                         (3.0 * hy);
+                    uz = (u(i, j, k + 1, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j, k - 1, 0)) /
+                         (3.0 * hz);
+                    vz = (u(i, j, k + 1, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i, j, k - 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_hi_x && fix_hi_y && fix_lo_z && i == ihi + 1 &&
+                    j == jhi + 1 && k == klo) {
+                    vx = -(u(i - 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i + 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = -(u(i - 1, j, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i + 1, j, k, 2)) /
+                         (3.0 * hx);
+                    uy = -(u(i, j - 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j + 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = -(u(i, j - 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i, j + 1, k, 2)) /
+                         (3.0 * hy);
+                    uz = (u(i, j, k + 1, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j, k - 1, 0)) /
+                         (3.0 * hz);
+                    vz = (u(i, j, k + 1, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i, j, k - 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_lo_x && fix_lo_y && fix_hi_z && i == ilo && j == jlo &&
+                    k == khi + 1) {
+                    vx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    uy = (u(i, j + 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j - 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = (u(i, j + 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                          4.0 * u(i, j - 1, k, 2)) /
+                         (3.0 * hy);
+                    uz = -(u(i, j, k - 1, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j, k + 1, 0)) /
+                         (3.0 * hz);
+                    vz = -(u(i, j, k - 1, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i, j, k + 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_hi_x && fix_lo_y && fix_hi_z && i == ihi + 1 &&
+                    j == jlo && k == khi + 1) {
+                    vx = -(u(i - 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i + 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = -(u(i - 1, j, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i + 1, j, k, 2)) /
+                         (3.0 * hx);
+                    uy = (u(i, j + 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                          4.0 * u(i, j - 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = (u(i, j + 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                          4.0 * u(i, j - 1, k, 2)) /
+                         (3.0 * hy);
+                    uz = -(u(i, j, k - 1, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j, k + 1, 0)) /
+                         (3.0 * hz);
+                    vz = -(u(i, j, k - 1, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i, j, k + 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_lo_x && fix_hi_y && fix_hi_z && i == ilo &&
+                    j == jhi + 1 && k == khi + 1) {
+                    vx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = (u(i + 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                          4.0 * u(i - 1, j, k, 1)) /
+                         (3.0 * hx);
+                    uy = -(u(i, j - 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j + 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = -(u(i, j - 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i, j + 1, k, 2)) /
+                         (3.0 * hy);
+                    uz = -(u(i, j, k - 1, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j, k + 1, 0)) /
+                         (3.0 * hz);
+                    vz = -(u(i, j, k - 1, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i, j, k + 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                if (fix_hi_x && fix_hi_y && fix_hi_z && i == ihi + 1 &&
+                    j == jhi + 1 && k == khi + 1) {
+                    vx = -(u(i - 1, j, k, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i + 1, j, k, 1)) /
+                         (3.0 * hx);
+                    wx = -(u(i - 1, j, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i + 1, j, k, 2)) /
+                         (3.0 * hx);
+                    uy = -(u(i, j - 1, k, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j + 1, k, 0)) /
+                         (3.0 * hy);
+                    wy = -(u(i, j - 1, k, 2) + 3.0 * u(i, j, k, 2) -
+                           4.0 * u(i, j + 1, k, 2)) /
+                         (3.0 * hy);
+                    uz = -(u(i, j, k - 1, 0) + 3.0 * u(i, j, k, 0) -
+                           4.0 * u(i, j, k + 1, 0)) /
+                         (3.0 * hz);
+                    vz = -(u(i, j, k - 1, 1) + 3.0 * u(i, j, k, 1) -
+                           4.0 * u(i, j, k + 1, 1)) /
+                         (3.0 * hz);
+                }
+
+                vort(i, j, k) =
+                    sqrt((wy - vz) * (wy - vz) + (uz - wx) * (uz - wx) +
+                         (vx - uy) * (vx - uy));
+            });
+#endif
+        }
+    }
+
+    // average down and fill ghost cells
+    AverageDown(vorticity, 0, 1);
+    FillPatch(t_old, vorticity, vorticity, vorticity, 0, 0, 1, 0, bcs_f);
+}
+
+void Maestro::MakeDeltaGamma(const Vector<MultiFab>& state,
+                             const BaseState<Real>& p0,
+                             const BaseState<Real>& gamma1bar,
+                             Vector<MultiFab>& deltagamma) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeDeltaGamma()", MakeDeltaGamma);
+
+    const auto use_pprime_in_tfromp_loc = use_pprime_in_tfromp;
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(state[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            // Get the index space of the valid region
+            const Box& tileBox = mfi.tilebox();
+
+            const Array4<const Real> state_arr = state[lev].array(mfi);
+            const BaseStateView p0_view =
+                MakeBaseStateView(p0, lev, mfi, false);
+            const BaseStateView gamma1bar_view =
+                MakeBaseStateView(gamma1bar, lev, mfi, false);
+            const Array4<Real> deltagamma_arr = deltagamma[lev].array(mfi);
+
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                eos_t eos_state;
+
+                eos_state.rho = state_arr(i, j, k, Rho);
+                eos_state.T = state_arr(i, j, k, Temp);
+                if (use_pprime_in_tfromp_loc) {
+                    eos_state.p = p0_view(i, j, k) + state_arr(i, j, k, Pi);
+                } else {
+                    eos_state.p = p0_view(i, j, k);
+                }
+
+                for (auto comp = 0; comp < NumSpec; ++comp) {
+                    eos_state.xn[comp] =
+                        state_arr(i, j, k, FirstSpec + comp) / eos_state.rho;
+                }
+#if NAUX_NET > 0
+                for (auto comp = 0; comp < NumAux; ++comp) {
+                    eos_state.aux[comp] =
+                        state_arr(i, j, k, FirstAux + comp) / eos_state.rho;
+                }
+#endif
+
+                eos(eos_input_rp, eos_state);
+
+                deltagamma_arr(i, j, k) =
+                    eos_state.gam1 - gamma1bar_view(i, j, k);
+            });
+        }
+    }
+
+    // average down and fill ghost cells
+    AverageDown(deltagamma, 0, 1);
+    FillPatch(t_old, deltagamma, deltagamma, deltagamma, 0, 0, 1, 0, bcs_f);
+}
+
+void Maestro::MakeEntropy(const Vector<MultiFab>& state,
+                          Vector<MultiFab>& entropy) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeEntropy()", MakeEntropy);
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(state[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            // Get the index space of the valid region
+            const Box& tileBox = mfi.tilebox();
+
+            const Array4<const Real> state_arr = state[lev].array(mfi);
+            const Array4<Real> entropy_arr = entropy[lev].array(mfi);
+
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                eos_t eos_state;
+
+                eos_state.rho = state_arr(i, j, k, Rho);
+                eos_state.T = state_arr(i, j, k, Temp);
+                for (auto comp = 0; comp < NumSpec; ++comp) {
+                    eos_state.xn[comp] = state_arr(i, j, k, FirstSpec + comp) /
+                                         state_arr(i, j, k, Rho);
+                }
+#if NAUX_NET > 0
+                for (auto comp = 0; comp < NumAux; ++comp) {
+                    eos_state.aux[comp] = state_arr(i, j, k, FirstAux + comp) /
+                                          state_arr(i, j, k, Rho);
+                }
+#endif
+
+                eos(eos_input_rt, eos_state);
+
+                entropy_arr(i, j, k) = eos_state.s;
+            });
+        }
+    }
+
+    // average down and fill ghost cells
+    AverageDown(entropy, 0, 1);
+    FillPatch(t_old, entropy, entropy, entropy, 0, 0, 1, 0, bcs_f);
+}
+
+void Maestro::MakeDivw0(
+    const Vector<std::array<MultiFab, AMREX_SPACEDIM> >& w0mac,
+    Vector<MultiFab>& divw0) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeDivw0()", MakeDivw0);
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        if (!spherical) {
+            // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for (MFIter mfi(divw0[lev], TilingIfNotGPU()); mfi.isValid();
+                 ++mfi) {
+                // Get the index space of the valid region
+                const Box& tileBox = mfi.tilebox();
+                const auto dx = geom[lev].CellSizeArray();
+
+                const Array4<const Real> w0_arr = w0_cart[lev].array(mfi);
+                const Array4<Real> divw0_arr = divw0[lev].array(mfi);
+
+                ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+#if (AMREX_SPACEDIM == 2)
+                    divw0_arr(i, j, k) =
+                        (w0_arr(i, j + 1, k, 1) - w0_arr(i, j, k, 1)) / dx[1];
+#else
+                    divw0_arr(i,j,k) = (w0_arr(i,j,k+1,2) - w0_arr(i,j,k,2)) / dx[2];
+#endif
+                });
+            }
+
+        } else {
+            // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for (MFIter mfi(divw0[lev], TilingIfNotGPU()); mfi.isValid();
+                 ++mfi) {
+                // Get the index space of the valid region
+                const Box& tileBox = mfi.tilebox();
+                const auto dx = geom[lev].CellSizeArray();
+
+                const Array4<const Real> w0macx = w0mac[lev][0].array(mfi);
+                const Array4<const Real> w0macy = w0mac[lev][1].array(mfi);
+                const Array4<const Real> w0macz = w0mac[lev][2].array(mfi);
+                const Array4<Real> divw0_arr = divw0[lev].array(mfi);
+
+                ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                    divw0_arr(i, j, k) =
+                        (w0macx(i + 1, j, k) - w0macx(i, j, k)) / dx[0] +
+                        (w0macy(i, j + 1, k) - w0macy(i, j, k)) / dx[1] +
+                        (w0macz(i, j, k + 1) - w0macz(i, j, k)) / dx[2];
+                });
+            }
+        }
+    }
+
+    // average down and fill ghost cells
+    AverageDown(divw0, 0, 1);
+    FillPatch(t_old, divw0, divw0, divw0, 0, 0, 1, 0, bcs_f);
+}
+
+void Maestro::MakePiDivu(const Vector<MultiFab>& vel,
+                         const Vector<MultiFab>& state,
+                         Vector<MultiFab>& pidivu) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakePiDivu()", MakePiDivu);
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(pidivu[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            // Get the index space of the valid region
+            const Box& tileBox = mfi.tilebox();
+            const auto dx = geom[lev].CellSizeArray();
+
+            const Array4<const Real> vel_arr = vel[lev].array(mfi);
+            const Array4<const Real> pi_cc = state[lev].array(mfi, Pi);
+            const Array4<Real> pidivu_arr = pidivu[lev].array(mfi);
+
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                pidivu_arr(i, j, k) =
+                    pi_cc(i, j, k) * 0.5 *
+                    ((vel_arr(i + 1, j, k, 0) - vel_arr(i - 1, j, k, 0)) /
+                         dx[0] +
+                     (vel_arr(i, j + 1, k, 1) - vel_arr(i, j - 1, k, 1)) / dx[1]
+#if (AMREX_SPACEDIM == 3)
+                     +
+                     (vel_arr(i, j, k + 1, 2) - vel_arr(i, j, k - 1, 2)) / dx[2]
+#endif
+                    );
+            });
+        }
+    }
+
+    // average down and fill ghost cells
+    AverageDown(pidivu, 0, 1);
+    FillPatch(t_old, pidivu, pidivu, pidivu, 0, 0, 1, 0, bcs_f);
+}
+
+void Maestro::MakeAbar(const Vector<MultiFab>& state, Vector<MultiFab>& abar) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeAbar()", MakeAbar);
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(abar[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            // Get the index space of the valid region
+            const Box& tileBox = mfi.tilebox();
+
+            const Array4<const Real> state_arr = state[lev].array(mfi);
+            const Array4<Real> abar_arr = abar[lev].array(mfi);
+
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                Real denominator = 0.0;
+
+                for (auto comp = 0; comp < NumSpec; ++comp) {
+                    denominator +=
+                        state_arr(i, j, k, FirstSpec + comp) / aion[comp];
+                }
+
+                abar_arr(i, j, k) = state_arr(i, j, k, Rho) / denominator;
+            });
+        }
+    }
+
+    // average down and fill ghost cells
+    AverageDown(abar, 0, 1);
+    FillPatch(t_old, abar, abar, abar, 0, 0, 1, 0, bcs_f);
+}
@@ -0,0 +1,194 @@
+
+#include <BaseStateFile.H>
+#include <Maestro.H>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+using namespace amrex;
+
+// bin the plot variables profile_vars of the new state into radial shells
+// (spherical) or horizontal layers (planar), and append their mean, rms
+// fluctuation, min and max in each bin to profile_file
+void Maestro::WriteProfiles(const int step, const Real t_in) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::WriteProfiles()", WriteProfiles);
+
+    // wallclock time
+    const Real strt_total = ParallelDescriptor::second();
+
+    // the plot variables to profile
+    Vector<std::string> varnames;
+    for (const auto& var : PlotVarRegistry()) {
+        for (const auto& name : var.names) {
+            varnames.push_back(name);
+        }
+    }
+
+    Vector<std::string> names;
+    std::stringstream sstream(profile_vars);
+    std::string nm;
+    while (sstream >> nm) {
+        if (std::find(varnames.begin(), varnames.end(), nm) ==
+            varnames.end()) {
+            Print() << "Profile variable " << nm << " is invalid\n";
+        } else if (std::find(names.begin(), names.end(), nm) ==
+                   names.end()) {
+            names.push_back(nm);
+        }
+    }
+
+    const int nvars = names.size();
+    if (nvars == 0) {
+        return;
+    }
+
+    const auto& mf =
+        PlotFileVarsMF(names, t_in, dt, rho0_new, rhoh0_new, p0_new,
+                       gamma1bar_new, unew, snew, S_cc_new);
+
+    // the variables followed by their squares
+    Vector<MultiFab> vals(finest_level + 1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        vals[lev].define(grids[lev], dmap[lev], 2 * nvars, 0);
+        MultiFab::Copy(vals[lev], *mf[lev], 0, 0, nvars, 0);
+        MultiFab::Copy(vals[lev], *mf[lev], 0, nvars, nvars, 0);
+        MultiFab::Multiply(vals[lev], *mf[lev], 0, nvars, nvars, 0);
+    }
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        delete mf[lev];
+    }
+
+    // the mean of each variable and of its square, binned and averaged
+    // like the base state
+    Vector<BaseState<Real> > avg(2 * nvars);
+    Vector<AverageField> fields;
+    for (int n = 0; n < 2 * nvars; ++n) {
+        avg[n].define(base_geom.max_radial_level + 1, base_geom.nr_fine);
+        fields.push_back({vals, n, avg[n]});
+
+        if (int(fields.size()) == MAESTRO_MAX_AVERAGE_FIELDS ||
+            n == 2 * nvars - 1) {
+            Average(fields);
+            fields.clear();
+        }
+    }
+
+    // the min and max of each variable over the cells of each level 0 bin.
+    // The covered coarse cells are averages of the fine cells, so they
+    // cannot widen the range.
+    const int nbins = base_geom.nr(0);
+    BaseState<Real> vmin_s(1, nbins, nvars,
+                           std::numeric_limits<Real>::max());
+    BaseState<Real> vmax_s(1, nbins, nvars,
+                           std::numeric_limits<Real>::lowest());
+    auto vmin = vmin_s.array();
+    auto vmax = vmax_s.array();
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // no OpenMP: the host versions of Atomic::Min and Max are not
+        // thread safe
+        for (MFIter mfi(vals[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            // Get the index space of the valid region
+            const Box& tilebox = mfi.tilebox();
+
+            const Array4<const Real> vals_arr = vals[lev].const_array(mfi);
+            const BaseStateView view =
+                MakeBaseStateView(avg[0], lev, mfi, false);
+
+            ParallelFor(tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                const int r = amrex::min(amrex::max(view.CellBin(i, j, k), 0),
+                                         nbins - 1);
+                for (int n = 0; n < nvars; ++n) {
+                    Gpu::Atomic::Min(&vmin(0, r, n), vals_arr(i, j, k, n));
+                    Gpu::Atomic::Max(&vmax(0, r, n), vals_arr(i, j, k, n));
+                }
+            });
+        }
+    }
+    Gpu::synchronize();
+
+    ParallelDescriptor::ReduceRealMin(vmin_s.dataPtr(), nbins * nvars,
+                                      ParallelDescriptor::IOProcessorNumber());
+    ParallelDescriptor::ReduceRealMax(vmax_s.dataPtr(), nbins * nvars,
+                                      ParallelDescriptor::IOProcessorNumber());
+
+    if (ParallelDescriptor::IOProcessor()) {
+        Vector<std::string> profile_names = {"r_cc"};
+        for (const auto& name : names) {
+            profile_names.push_back("mean(" + name + ")");
+            profile_names.push_back("rms(" + name + ")");
+            profile_names.push_back("min(" + name + ")");
+            profile_names.push_back("max(" + name + ")");
+        }
+
+        BaseStateFile profile;
+        profile.Define(profile_names, 1, nbins);
+
+        double* r_cc = profile.Field("r_cc");
+        for (int r = 0; r < nbins; ++r) {
+            r_cc[r] = base_geom.r_cc_loc(0, r);
+        }
+
+        for (int n = 0; n < nvars; ++n) {
+            const auto mean = avg[n].const_array();
+            const auto meansq = avg[nvars + n].const_array();
+            double* mean_n = profile.Field("mean(" + names[n] + ")");
+            double* rms_n = profile.Field("rms(" + names[n] + ")");
+            double* min_n = profile.Field("min(" + names[n] + ")");
+            double* max_n = profile.Field("max(" + names[n] + ")");
+
+            for (int r = 0; r < nbins; ++r) {
+                mean_n[r] = mean(0, r);
+                // rms of the fluctuations about the mean
+                rms_n[r] = std::sqrt(
+                    amrex::max(meansq(0, r) - mean(0, r) * mean(0, r), 0.0));
+                min_n[r] = vmin(0, r, n);
+                max_n[r] = vmax(0, r, n);
+            }
+        }
+
+        const std::string contents = profile.Write();
+
+        // start a new file unless we are continuing a run
+        const bool new_file = !profile_started && restart_file.empty();
+        std::ofstream ProfileFile(
+            profile_file,
+            std::ofstream::out | std::ofstream::binary |
+                (new_file ? std::ofstream::trunc : std::ofstream::app));
+        if (!ProfileFile.good()) {
+            amrex::FileOpenFailed(profile_file);
+        }
+
+        // each record is the step, the time and the size of the base state
+        // file holding the profiles, followed by that file.  The record
+        // header uses the byte order given in the base state file.
+        const std::int64_t step_rec = step;
+        const double time_rec = t_in;
+        const std::uint64_t size_rec = contents.size();
+        ProfileFile.write(reinterpret_cast<const char*>(&step_rec),
+                          sizeof(step_rec));
+        ProfileFile.write(reinterpret_cast<const char*>(&time_rec),
+                          sizeof(time_rec));
+        ProfileFile.write(reinterpret_cast<const char*>(&size_rec),
+                          sizeof(size_rec));
+        ProfileFile << contents;
+        ProfileFile.close();
+    }
+
+    profile_started = true;
+
+    // wallclock time
+    Real end_total = ParallelDescriptor::second() - strt_total;
+
+    // print wallclock time
+    ParallelDescriptor::ReduceRealMax(end_total,
+                                      ParallelDescriptor::IOProcessorNumber());
+    if (maestro_verbose > 0) {
+        Print() << "Time to write profiles: " << end_total << '\n';
+    }
+}
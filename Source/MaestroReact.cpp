@@ -37,18 +37,32 @@ void Maestro::React(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
         }
     }
 
+    // whether s_out has already been averaged down and had its ghost cells
+    // filled
+    bool filled = false;
+
     // apply burning term
     if (do_burning) {
-#ifndef SDC
-        // do the burning, update rho_omegadot and rho_Hnuc
-        // we pass in rho_Hext so that we can add it to rhoh in case we applied heating
-        Burner(s_in, s_out, rho_Hext, rho_omegadot, rho_Hnuc, p0, dt_in,
-               time_in);
-#endif
         // pass temperature through for seeding the temperature update eos call
+        // (the burner doesn't touch it, so this can be done first)
         for (int lev = 0; lev <= finest_level; ++lev) {
             MultiFab::Copy(s_out[lev], s_in[lev], Temp, Temp, 1, 0);
         }
+#ifndef SDC
+        // do the burning, update rho_omegadot and rho_Hnuc
+        // we pass in rho_Hext so that we can add it to rhoh in case we applied heating
+        if (overlap_burn_fill) {
+            BurnAndFillPatch(s_out, [&](const int lev,
+                                        const BurnRegion region) {
+                Burner(s_in, s_out, rho_Hext, rho_omegadot, rho_Hnuc, p0,
+                       dt_in, time_in, lev, region);
+            });
+            filled = true;
+        } else {
+            Burner(s_in, s_out, rho_Hext, rho_omegadot, rho_Hnuc, p0, dt_in,
+                   time_in);
+        }
+#endif
     } else {
         // not burning, so we zero rho_omegadot and rho_Hnuc
         for (int lev = 0; lev <= finest_level; ++lev) {
@@ -65,8 +79,10 @@ void Maestro::React(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
     }
 
     // average down and fill ghost cells
-    AverageDown(s_out, 0, Nscal);
-    FillPatch(t_old, s_out, s_out, s_out, 0, 0, Nscal, 0, bcs_s);
+    if (!filled) {
+        AverageDown(s_out, 0, Nscal);
+        FillPatch(t_old, s_out, s_out, s_out, 0, 0, Nscal, 0, bcs_s);
+    }
 
     // average down (no ghost cells)
     AverageDown(rho_Hext, 0, 1);
@@ -118,6 +134,10 @@ void Maestro::ReactSDC(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
         }
     }
 
+    // whether s_out has already been averaged down and had its ghost cells
+    // filled
+    bool filled = false;
+
     // apply burning term
     if (do_burning) {
         // copy s_in into s_out to fill coarse grids that are masked
@@ -126,7 +146,15 @@ void Maestro::ReactSDC(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
         }
 #ifdef SDC
         // do the burning, update s_out
-        Burner(s_in, s_out, p0, dt_in, time_in, source);
+        if (overlap_burn_fill) {
+            BurnAndFillPatch(s_out, [&](const int lev,
+                                        const BurnRegion region) {
+                Burner(s_in, s_out, p0, dt_in, time_in, source, lev, region);
+            });
+            filled = true;
+        } else {
+            Burner(s_in, s_out, p0, dt_in, time_in, source);
+        }
 #endif
     }
 
@@ -138,8 +166,10 @@ void Maestro::ReactSDC(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
     }
 
     // average down and fill ghost cells
-    AverageDown(s_out, 0, Nscal);
-    FillPatch(t_old, s_out, s_out, s_out, 0, 0, Nscal, 0, bcs_s);
+    if (!filled) {
+        AverageDown(s_out, 0, Nscal);
+        FillPatch(t_old, s_out, s_out, s_out, 0, 0, Nscal, 0, bcs_s);
+    }
 
     // average down (no ghost cells)
     if (do_heating) {
@@ -154,6 +184,48 @@ void Maestro::ReactSDC(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
     }
 }
 
+// burn, average down and fill the ghost cells of s_out, overlapping the
+// exchange of the level 0 ghost cells with the burning of the level 0
+// cells that aren't exchanged
+void Maestro::BurnAndFillPatch(
+    Vector<MultiFab>& s_out,
+    const std::function<void(const int, const BurnRegion)>& burn) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::BurnAndFillPatch()", BurnAndFillPatch);
+
+    // burn the finer levels first, so that the cells of each level that are
+    // covered by finer cells are final before it is exchanged
+    for (int lev = finest_level; lev > 0; --lev) {
+        burn(lev, BurnRegion::All);
+        average_down(s_out[lev], s_out[lev - 1], geom[lev], geom[lev - 1], 0,
+                     Nscal, refRatio(lev - 1));
+    }
+
+    // burn the edge of each level 0 grid, which the ghost cells read, start
+    // exchanging it and burn the interior while the messages are in flight
+    const IntVect ng = s_out[0].nGrowVect();
+    burn(0, BurnRegion::Edge);
+    s_out[0].FillBoundary_nowait(0, Nscal, ng, geom[0].periodicity());
+    burn(0, BurnRegion::Interior);
+    s_out[0].FillBoundary_finish();
+
+    // physical boundaries, as FillPatch does on level 0
+    Vector<BCRec> bcs{bcs_s.begin(), bcs_s.begin() + Nscal};
+    PhysBCFunctMaestro physbc;
+    physbc.define(geom[0], bcs, BndryFuncArrayMaestro(ScalarFill));
+    physbc(s_out[0], 0, Nscal, ng, t_old, 0);
+
+    // level 0 was filled without FillPatch, so record the update here
+    StateModified(s_out[0], 0, Nscal);
+
+    // the finer levels interpolate their coarse-fine ghost cells from the
+    // coarser level, so they are filled once it is complete
+    for (int lev = 1; lev <= finest_level; ++lev) {
+        FillPatch(lev, t_old, s_out[lev], s_out, s_out, 0, 0, Nscal, 0,
+                  bcs_s);
+    }
+}
+
 // #ifndef SDC
 // void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
 //                      const Vector<MultiFab>& rho_Hext,
@@ -416,3 +488,51 @@ void Maestro::MakeReactionRates(Vector<MultiFab>& rho_omegadot,
         AverageDown(rho_Hnuc, 0, 1);
     }
 }
+
+// compute rho_Hext for s_in, and make sure rho_omegadot and rho_Hnuc hold
+// reaction rates for the diagnostics and plotfiles.  These are normally the
+// rates of the last burn of the time step; only if there are none (before
+// the first burn or right after a regrid) do we burn s_in to get them.
+void Maestro::MakeReactionRatesForOutput(const Vector<MultiFab>& s_in,
+                                         Vector<MultiFab>& rho_Hext,
+                                         const BaseState<Real>& p0_in,
+                                         const Real dt_in, const Real t_in) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeReactionRatesForOutput()",
+                   MakeReactionRatesForOutput);
+
+    if (!have_reaction_rates) {
+        Vector<MultiFab> stemp(finest_level + 1);
+        Vector<MultiFab> sdc_source(finest_level + 1);
+
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            stemp[lev].define(grids[lev], dmap[lev], Nscal, 0);
+            sdc_source[lev].define(grids[lev], dmap[lev], Nscal, 0);
+
+            sdc_source[lev].setVal(0.);
+        }
+
+        const Real dt_react = dt_in < small_dt ? small_dt : 0.5 * dt_in;
+
+#ifndef SDC
+        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, dt_react,
+              t_in);
+#else
+        ReactSDC(s_in, stemp, rho_Hext, p0_in, dt_react, t_in, sdc_source);
+
+        MakeReactionRates(rho_omegadot, rho_Hnuc, s_in);
+#endif
+        have_reaction_rates = true;
+        return;
+    }
+
+    // the rates are already there, so only the heating has to be computed
+    if (do_heating) {
+        MakeHeating(rho_Hext, s_in);
+        AverageDown(rho_Hext, 0, 1);
+    } else {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            rho_Hext[lev].setVal(0.);
+        }
+    }
+}
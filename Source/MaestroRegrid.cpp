@@ -58,10 +58,28 @@ void Maestro::Regrid() {
         rho0_temp.copy(rho0_old);
     }
 
+    // the pooled scratch MultiFabs live on the old grids
+    scratch_pool.Clear();
+
     // regrid could add newly refine levels (if finest_level < max_level)
     // so we save the previous finest level index
     regrid(0, t_old);
 
+    // the reaction rates of the last burn are gone until the next one
+    have_reaction_rates = false;
+
+    // the EOS fields cached for the state live on the old grids
+    ++sold_version;
+    ++snew_version;
+
+    // distribute the new grids by their burn cost rather than cell count
+    if (load_balance_type > 0) {
+        RedistributeByCost();
+    }
+
+    // the multigrid operators are rebuilt if the grids changed
+    UpdateSolvers();
+
     // Redefine numdisjointchunks, r_start_coord, r_end_coord
     if (!spherical) {
         TagArray();
@@ -264,6 +282,23 @@ void Maestro::RemakeLevel(int lev, Real time, const BoxArray& ba,
 
     std::swap(w0_cart_state, w0_cart[lev]);
     std::swap(rhcc_for_nodalproj_state, rhcc_for_nodalproj[lev]);
+
+    // the reaction rates are not regridded, they are remade by the next burn
+    rho_omegadot[lev].define(ba, dm, NumSpec, 0);
+    rho_Hnuc[lev].define(ba, dm, 1, 0);
+
+    // keep the burn cost of the cells that were already on this level
+    MultiFab burn_cost_state(ba, dm, 1, 0);
+    burn_cost_state.setVal(1.);
+    burn_cost_state.ParallelCopy(burn_cost[lev], 0, 0, 1);
+    std::swap(burn_cost_state, burn_cost[lev]);
+
+    // the burn statistics are remade by the next burn
+    if (do_burn_stats) {
+        burn_stats[lev].define(ba, dm, 4, 0);
+        burn_stats[lev].setVal(0.);
+    }
+
     std::swap(pi_state, pi[lev]);
 #ifdef SDC
     FillPatch(lev, time, intra_state, intra, intra, 0, 0, Nscal, 0, bcs_f);
@@ -303,6 +338,13 @@ void Maestro::MakeNewLevelFromCoarse(int lev, Real time, const BoxArray& ba,
     dSdt[lev].define(ba, dm, 1, 0);
     w0_cart[lev].define(ba, dm, AMREX_SPACEDIM, 2);
     rhcc_for_nodalproj[lev].define(ba, dm, 1, 1);
+    rho_omegadot[lev].define(ba, dm, NumSpec, 0);
+    rho_Hnuc[lev].define(ba, dm, 1, 0);
+    burn_cost[lev].define(ba, dm, 1, 0);
+    if (do_burn_stats) {
+        burn_stats[lev].define(ba, dm, 4, 0);
+        burn_stats[lev].setVal(0.);
+    }
 
     pi[lev].define(convert(ba, nodal_flag), dm, 1, 0);  // nodal
 #ifdef SDC
@@ -326,6 +368,8 @@ void Maestro::MakeNewLevelFromCoarse(int lev, Real time, const BoxArray& ba,
                     bcs_f);
     FillCoarsePatch(lev, time, gpi[lev], gpi, gpi, 0, 0, AMREX_SPACEDIM, bcs_f);
     FillCoarsePatch(lev, time, dSdt[lev], dSdt, dSdt, 0, 0, 1, bcs_f);
+    FillCoarsePatch(lev, time, burn_cost[lev], burn_cost, burn_cost, 0, 0, 1,
+                    bcs_f);
 #ifdef SDC
     FillCoarsePatch(lev, time, intra[lev], intra, intra, 0, 0, Nscal, bcs_f);
 #endif
@@ -348,6 +392,10 @@ void Maestro::ClearLevel(int lev) {
     dSdt[lev].clear();
     w0_cart[lev].clear();
     rhcc_for_nodalproj[lev].clear();
+    rho_omegadot[lev].clear();
+    rho_Hnuc[lev].clear();
+    burn_cost[lev].clear();
+    burn_stats[lev].clear();
     pi[lev].clear();
 #ifdef SDC
     intra[lev].clear();
@@ -355,6 +403,14 @@ void Maestro::ClearLevel(int lev) {
     if (spherical) {
         normal[lev].clear();
         cell_cc_to_r[lev].clear();
+        cell_radial_bin[lev].clear();
+        cell_radial_bin_fine_grids[lev] = BoxArray();
+        cc_stencil[lev].clear();
+        edge_stencil[lev].clear();
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            s0mac_stencil[lev][d].clear();
+            w0mac_stencil[lev][d].clear();
+        }
     }
 
     flux_reg_s[lev].reset(nullptr);
@@ -426,3 +482,137 @@ void Maestro::RegridBaseState(BaseState<Real>& base_s, const bool is_edge) {
     // copy temp array back into the real thing
     base_s.copy(state_temp_s);
 }
+
+// rebalance the grids outside of a regrid
+void Maestro::LoadBalance() {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::LoadBalance()", LoadBalance);
+
+    if (!RedistributeByCost()) {
+        return;
+    }
+
+    // the pooled scratch MultiFabs live on the old distribution
+    scratch_pool.Clear();
+
+    // so do the multigrid operators
+    UpdateSolvers();
+
+    // the normal and the cached stencils and radial bins are rebuilt on
+    // the new distribution
+    if (spherical) {
+        MakeNormal();
+#if (AMREX_SPACEDIM == 3)
+        if (use_exact_base_state) {
+            MakeRadialStencils();
+        }
+#endif
+    }
+}
+
+// ratio of the mean to the maximum cost per rank of boxes with the given
+// cost distributed by dm
+static Real LoadEfficiency(const Vector<Real>& cost,
+                           const DistributionMapping& dm) {
+    Vector<Real> rank_cost(ParallelDescriptor::NProcs(), 0.0);
+    const int nboxes = cost.size();
+    for (int i = 0; i < nboxes; ++i) {
+        rank_cost[dm[i]] += cost[i];
+    }
+
+    Real sum = 0.0;
+    Real max = 0.0;
+    for (const auto c : rank_cost) {
+        sum += c;
+        max = amrex::max(max, c);
+    }
+
+    return max > 0.0 ? sum / (rank_cost.size() * max) : 1.0;
+}
+
+bool Maestro::RedistributeByCost() {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::RedistributeByCost()", RedistributeByCost);
+
+    bool changed = false;
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // total burn cost of each box
+        Vector<Real> cost(grids[lev].size(), 0.0);
+        for (MFIter mfi(burn_cost[lev]); mfi.isValid(); ++mfi) {
+            cost[mfi.index()] =
+                burn_cost[lev][mfi].sum<RunOn::Device>(mfi.validbox(), 0);
+        }
+        ParallelDescriptor::ReduceRealSum(cost.dataPtr(), cost.size());
+
+        const DistributionMapping dm =
+            (load_balance_type == 1)
+                ? DistributionMapping::makeKnapSack(cost)
+                : DistributionMapping::makeSFC(cost, grids[lev]);
+
+        const Real old_eff = LoadEfficiency(cost, dmap[lev]);
+        const Real new_eff = LoadEfficiency(cost, dm);
+
+        if (maestro_verbose > 0) {
+            Print() << "Level " << lev << " load balance efficiency "
+                    << old_eff << ", cost-weighted " << new_eff << std::endl;
+        }
+
+        if (new_eff >= load_balance_threshold * old_eff) {
+            RedistributeLevel(lev, dm);
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+void Maestro::RedistributeLevel(int lev, const DistributionMapping& dm) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::RedistributeLevel()", RedistributeLevel);
+
+    // copy mf, ghost cells and all, onto the new distribution
+    const auto move = [&dm](auto& mf) {
+        if (!mf.ok()) {
+            return;
+        }
+        std::decay_t<decltype(mf)> mf_state(mf.boxArray(), dm, mf.nComp(),
+                                            mf.nGrowVect());
+        mf_state.ParallelCopy(mf, 0, 0, mf.nComp(), mf.nGrowVect(),
+                              mf.nGrowVect());
+        std::swap(mf_state, mf);
+    };
+
+    move(sold[lev]);
+    move(snew[lev]);
+    move(uold[lev]);
+    move(unew[lev]);
+    move(S_cc_old[lev]);
+    move(S_cc_new[lev]);
+    move(gpi[lev]);
+    move(dSdt[lev]);
+    move(pi[lev]);
+    move(intra[lev]);
+    move(w0_cart[lev]);
+    move(rhcc_for_nodalproj[lev]);
+    move(rho_omegadot[lev]);
+    move(rho_Hnuc[lev]);
+    move(burn_cost[lev]);
+    move(burn_stats[lev]);
+
+    if (spherical) {
+        move(normal[lev]);
+        move(cell_cc_to_r[lev]);
+    }
+
+    if (lev > 0 && reflux_type == 2) {
+        flux_reg_s[lev] = std::make_unique<FluxRegister>(
+            grids[lev], dm, refRatio(lev - 1), lev, Nscal);
+    }
+
+    SetDistributionMap(lev, dm);
+
+    // the EOS fields cached for the state live on the old distribution
+    ++sold_version;
+    ++snew_version;
+}
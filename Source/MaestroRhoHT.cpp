@@ -1,5 +1,6 @@
 
 #include <Maestro.H>
+#include <MaestroEos.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
@@ -8,16 +9,12 @@ void Maestro::TfromRhoH(Vector<MultiFab>& scal, const BaseState<Real>& p0) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::TfromRhoH()", TfromRhoH);
 
-    Vector<MultiFab> p0_cart(finest_level + 1);
-
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].setVal(0.);
-    }
-    Put1dArrayOnCart(p0, p0_cart, false, false, bcs_f, 0);
-
     const auto use_eos_e_instead_of_h_loc = use_eos_e_instead_of_h;
 
+    // (rho, (h->e)) --> T, p or (rho, h) --> T, p
+    const eos_input_t input =
+        use_eos_e_instead_of_h_loc ? eos_input_re : eos_input_rh;
+
     for (int lev = 0; lev <= finest_level; ++lev) {
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -28,59 +25,25 @@ void Maestro::TfromRhoH(Vector<MultiFab>& scal, const BaseState<Real>& p0) {
             const Box& tileBox = mfi.tilebox();
 
             const Array4<Real> state = scal[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
-
-            if (use_eos_e_instead_of_h_loc) {
-                // (rho, (h->e)) --> T, p
-                ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                    eos_t eos_state;
-
-                    eos_state.rho = state(i, j, k, Rho);
-                    eos_state.T = state(i, j, k, Temp);
-                    for (auto n = 0; n < NumSpec; ++n) {
-                        eos_state.xn[n] =
-                            state(i, j, k, FirstSpec + n) / eos_state.rho;
-                    }
-#if NAUX_NET > 0
-                    for (auto n = 0; n < NumAux; ++n) {
-                        eos_state.aux[n] =
-                            state(i, j, k, FirstAux + n) / eos_state.rho;
-                    }
-#endif
-
-                    // e = (rhoh - p)/rho
-                    eos_state.e = (state(i, j, k, RhoH) - p0_arr(i, j, k)) /
-                                  state(i, j, k, Rho);
-
-                    eos(eos_input_re, eos_state);
-
-                    state(i, j, k, Temp) = eos_state.T;
-                });
-            } else {
-                // (rho, h) --> T, p
-                ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                    eos_t eos_state;
-
-                    eos_state.rho = state(i, j, k, Rho);
-                    eos_state.T = state(i, j, k, Temp);
-                    for (auto n = 0; n < NumSpec; ++n) {
-                        eos_state.xn[n] =
-                            state(i, j, k, FirstSpec + n) / eos_state.rho;
-                    }
-#if NAUX_NET > 0
-                    for (auto n = 0; n < NumAux; ++n) {
-                        eos_state.aux[n] =
-                            state(i, j, k, FirstAux + n) / eos_state.rho;
+            const BaseStateView p0_view =
+                MakeBaseStateView(p0, lev, mfi, false);
+
+            EosSweep(
+                tileBox, input, state,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, Real&, Real& var) {
+                    if (use_eos_e_instead_of_h_loc) {
+                        // e = (rhoh - p)/rho
+                        var = (state(i, j, k, RhoH) - p0_view(i, j, k)) /
+                              state(i, j, k, Rho);
+                    } else {
+                        var = state(i, j, k, RhoH) / state(i, j, k, Rho);
                     }
-#endif
-
-                    eos_state.h = state(i, j, k, RhoH) / state(i, j, k, Rho);
-
-                    eos(eos_input_rh, eos_state);
-
+                    return true;
+                },
+                [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                     const eos_t& eos_state) {
                     state(i, j, k, Temp) = eos_state.T;
                 });
-            }
         }
     }
 
@@ -94,14 +57,6 @@ void Maestro::TfromRhoP(Vector<MultiFab>& scal, const BaseState<Real>& p0,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::TfromRhoP()", TfromRhoP);
 
-    Vector<MultiFab> p0_cart(finest_level + 1);
-
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].setVal(0.);
-    }
-    Put1dArrayOnCart(p0, p0_cart, false, false, bcs_f, 0);
-
     const auto use_pprime_in_tfromp_loc = use_pprime_in_tfromp;
 
     for (int lev = 0; lev <= finest_level; ++lev) {
@@ -113,40 +68,28 @@ void Maestro::TfromRhoP(Vector<MultiFab>& scal, const BaseState<Real>& p0,
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
             const Array4<Real> state = scal[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+            const BaseStateView p0_view =
+                MakeBaseStateView(p0, lev, mfi, false);
 
             // (rho, p) --> T
-            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                eos_t eos_state;
-
-                eos_state.rho = state(i, j, k, Rho);
-                eos_state.T = state(i, j, k, Temp);
-
-                if (use_pprime_in_tfromp_loc) {
-                    eos_state.p = p0_arr(i, j, k) + state(i, j, k, Pi);
-                } else {
-                    eos_state.p = p0_arr(i, j, k);
-                }
-
-                for (auto n = 0; n < NumSpec; ++n) {
-                    eos_state.xn[n] =
-                        state(i, j, k, FirstSpec + n) / eos_state.rho;
-                }
-#if NAUX_NET > 0
-                for (auto n = 0; n < NumAux; ++n) {
-                    eos_state.aux[n] =
-                        state(i, j, k, FirstAux + n) / eos_state.rho;
-                }
-#endif
-
-                eos(eos_input_rp, eos_state);
-
-                state(i, j, k, Temp) = eos_state.T;
+            EosSweep(
+                tileBox, eos_input_rp, state,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, Real&, Real& var) {
+                    if (use_pprime_in_tfromp_loc) {
+                        var = p0_view(i, j, k) + state(i, j, k, Pi);
+                    } else {
+                        var = p0_view(i, j, k);
+                    }
+                    return true;
+                },
+                [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                     const eos_t& eos_state) {
+                    state(i, j, k, Temp) = eos_state.T;
 
-                if (updateRhoH) {
-                    state(i, j, k, RhoH) = eos_state.rho * eos_state.h;
-                }
-            });
+                    if (updateRhoH) {
+                        state(i, j, k, RhoH) = eos_state.rho * eos_state.h;
+                    }
+                });
         }
     }
 
@@ -179,30 +122,17 @@ void Maestro::PfromRhoH(const Vector<MultiFab>& state,
             const Array4<Real> peos_arr = peos[lev].array(mfi);
 
             // (rho, H) --> T, p
-            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                eos_t eos_state;
-
-                eos_state.rho = state_arr(i, j, k, Rho);
-                eos_state.T = temp_old(i, j, k);
-
-                for (auto n = 0; n < NumSpec; ++n) {
-                    eos_state.xn[n] =
-                        state_arr(i, j, k, FirstSpec + n) / eos_state.rho;
-                }
-#if NAUX_NET > 0
-                for (auto n = 0; n < NumAux; ++n) {
-                    eos_state.aux[n] =
-                        state_arr(i, j, k, FirstAux + n) / eos_state.rho;
-                }
-#endif
-
-                eos_state.h =
-                    state_arr(i, j, k, RhoH) / state_arr(i, j, k, Rho);
-
-                eos(eos_input_rh, eos_state);
-
-                peos_arr(i, j, k) = eos_state.p;
-            });
+            EosSweep(
+                tileBox, eos_input_rh, state_arr,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, Real& T, Real& var) {
+                    T = temp_old(i, j, k);
+                    var = state_arr(i, j, k, RhoH) / state_arr(i, j, k, Rho);
+                    return true;
+                },
+                [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                     const eos_t& eos_state) {
+                    peos_arr(i, j, k) = eos_state.p;
+                });
         }
     }
 
@@ -219,16 +149,11 @@ void Maestro::MachfromRhoH(const Vector<MultiFab>& scal,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MachfromRhoH()", MachfromRhoH);
 
-    Vector<MultiFab> p0_cart(finest_level + 1);
-
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].setVal(0.);
-    }
-    Put1dArrayOnCart(p0, p0_cart, false, false, bcs_f, 0);
-
     const auto use_eos_e_instead_of_h_loc = use_eos_e_instead_of_h;
 
+    const eos_input_t input =
+        use_eos_e_instead_of_h_loc ? eos_input_re : eos_input_rh;
+
     for (int lev = 0; lev <= finest_level; ++lev) {
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -239,53 +164,41 @@ void Maestro::MachfromRhoH(const Vector<MultiFab>& scal,
             const Box& tileBox = mfi.tilebox();
             const Array4<const Real> state = scal[lev].array(mfi);
             const Array4<const Real> u = vel[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+            const BaseStateView p0_view =
+                MakeBaseStateView(p0, lev, mfi, false);
             const Array4<const Real> w0_arr = w0cart[lev].array(mfi);
             const Array4<Real> mach_arr = mach[lev].array(mfi);
 
-            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-
-            // vel is the magnitude of the velocity, including w0
+            EosSweep(
+                tileBox, input, state,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, Real&, Real& var) {
+                    if (use_eos_e_instead_of_h_loc) {
+                        // e = h - p/rho
+                        var = (state(i, j, k, RhoH) - p0_view(i, j, k)) /
+                              state(i, j, k, Rho);
+                    } else {
+                        var = state(i, j, k, RhoH) / state(i, j, k, Rho);
+                    }
+                    return true;
+                },
+                [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                     const eos_t& eos_state) {
+                    // vel is the magnitude of the velocity, including w0
 #if (AMREX_SPACEDIM == 2)
-                Real velocity = sqrt(u(i, j, k, 0) * u(i, j, k, 0) +
-                                     (u(i, j, k, 1) + w0_arr(i, j, k)) *
-                                         (u(i, j, k, 1) + w0_arr(i, j, k)));
+                    Real velocity =
+                        sqrt(u(i, j, k, 0) * u(i, j, k, 0) +
+                             (u(i, j, k, 1) + w0_arr(i, j, k)) *
+                                 (u(i, j, k, 1) + w0_arr(i, j, k)));
 #else
-                Real velocity = sqrt(u(i,j,k,0)*u(i,j,k,0) + 
-                    u(i,j,k,1)*u(i,j,k,1) + 
-                    (u(i,j,k,2) + w0_arr(i,j,k))*(u(i,j,k,2) + w0_arr(i,j,k)));
+                    Real velocity =
+                        sqrt(u(i, j, k, 0) * u(i, j, k, 0) +
+                             u(i, j, k, 1) * u(i, j, k, 1) +
+                             (u(i, j, k, 2) + w0_arr(i, j, k)) *
+                                 (u(i, j, k, 2) + w0_arr(i, j, k)));
 #endif
 
-                eos_t eos_state;
-
-                eos_state.rho = state(i, j, k, Rho);
-                eos_state.T = state(i, j, k, Temp);
-
-                for (auto n = 0; n < NumSpec; ++n) {
-                    eos_state.xn[n] =
-                        state(i, j, k, FirstSpec + n) / eos_state.rho;
-                }
-#if NAUX_NET > 0
-                for (auto n = 0; n < NumAux; ++n) {
-                    eos_state.aux[n] =
-                        state(i, j, k, FirstAux + n) / eos_state.rho;
-                }
-#endif
-
-                if (use_eos_e_instead_of_h_loc) {
-                    // e = h - p/rho
-                    eos_state.e = (state(i, j, k, RhoH) - p0_arr(i, j, k)) /
-                                  state(i, j, k, Rho);
-
-                    eos(eos_input_re, eos_state);
-                } else {
-                    eos_state.h = state(i, j, k, RhoH) / state(i, j, k, Rho);
-
-                    eos(eos_input_rh, eos_state);
-                }
-
-                mach_arr(i, j, k) = velocity / eos_state.cs;
-            });
+                    mach_arr(i, j, k) = velocity / eos_state.cs;
+                });
         }
     }
 
@@ -295,13 +208,15 @@ void Maestro::MachfromRhoH(const Vector<MultiFab>& scal,
 }
 
 void Maestro::CsfromRhoH(const Vector<MultiFab>& scal,
-                         const Vector<MultiFab>& p0_cart,
-                         Vector<MultiFab>& cs) {
+                         const BaseState<Real>& p0, Vector<MultiFab>& cs) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::CsfromRhoH()", CsfromRhoH);
 
     const auto use_eos_e_instead_of_h_loc = use_eos_e_instead_of_h;
 
+    const eos_input_t input =
+        use_eos_e_instead_of_h_loc ? eos_input_re : eos_input_rh;
+
     for (int lev = 0; lev <= finest_level; ++lev) {
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -311,40 +226,26 @@ void Maestro::CsfromRhoH(const Vector<MultiFab>& scal,
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
             const Array4<const Real> state = scal[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+            const BaseStateView p0_view =
+                MakeBaseStateView(p0, lev, mfi, false);
             const Array4<Real> cs_arr = cs[lev].array(mfi);
 
-            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                eos_t eos_state;
-
-                eos_state.rho = state(i, j, k, Rho);
-                eos_state.T = state(i, j, k, Temp);
-
-                for (auto n = 0; n < NumSpec; ++n) {
-                    eos_state.xn[n] =
-                        state(i, j, k, FirstSpec + n) / eos_state.rho;
-                }
-#if NAUX_NET > 0
-                for (auto n = 0; n < NumAux; ++n) {
-                    eos_state.aux[n] =
-                        state(i, j, k, FirstAux + n) / eos_state.rho;
-                }
-#endif
-
-                if (use_eos_e_instead_of_h_loc) {
-                    // e = h - p/rho
-                    eos_state.e = (state(i, j, k, RhoH) - p0_arr(i, j, k)) /
-                                  state(i, j, k, Rho);
-
-                    eos(eos_input_re, eos_state);
-                } else {
-                    eos_state.h = state(i, j, k, RhoH) / state(i, j, k, Rho);
-
-                    eos(eos_input_rh, eos_state);
-                }
-
-                cs_arr(i, j, k) = eos_state.cs;
-            });
+            EosSweep(
+                tileBox, input, state,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, Real&, Real& var) {
+                    if (use_eos_e_instead_of_h_loc) {
+                        // e = h - p/rho
+                        var = (state(i, j, k, RhoH) - p0_view(i, j, k)) /
+                              state(i, j, k, Rho);
+                    } else {
+                        var = state(i, j, k, RhoH) / state(i, j, k, Rho);
+                    }
+                    return true;
+                },
+                [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                     const eos_t& eos_state) {
+                    cs_arr(i, j, k) = eos_state.cs;
+                });
         }
     }
 
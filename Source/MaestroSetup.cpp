@@ -1,4 +1,5 @@
 
+#include <AMReX_AsyncOut.H>
 #include <Maestro.H>
 #include <Maestro_F.H>
 
@@ -41,6 +42,9 @@ void Maestro::Setup() {
     maestro_network_init();
     network_init();
 
+    // choose the EOS-derived fields to cache
+    InitEosCache();
+
     maestro_eos_init();
     eos_init(maestro::small_temp, maestro::small_dens);
 
@@ -55,6 +59,18 @@ void Maestro::Setup() {
         Abort("max_level exceeds MAESTROeX's limit!");
     }
 
+    // the background plotfile and checkpoint writes go through the AMReX
+    // I/O thread
+    if (async_plotfile && !AsyncOut::UseAsyncOut()) {
+        Abort("async_plotfile requires amrex.async_out = 1");
+    }
+    if (async_plotfile && async_plotfile_max < 1) {
+        Abort("async_plotfile_max must be at least 1");
+    }
+    if (async_checkpoint && !AsyncOut::UseAsyncOut()) {
+        Abort("async_checkpoint requires amrex.async_out = 1");
+    }
+
     const Real* probLo = geom[0].ProbLo();
     const Real* probHi = geom[0].ProbHi();
 
@@ -148,12 +164,17 @@ void Maestro::Setup() {
     diagfile1_data.resize(diag_buf_size * 11);
     diagfile2_data.resize(diag_buf_size * 11);
     diagfile3_data.resize(diag_buf_size * 10);
+    if (do_burn_stats) {
+        diagfile4_data.resize(diag_buf_size *
+                              (1 + ndiag_burn * (max_level + 1)));
+    }
 
     // make sure C++ is as efficient as possible with memory usage
     tag_array.shrink_to_fit();
     diagfile1_data.shrink_to_fit();
     diagfile2_data.shrink_to_fit();
     diagfile3_data.shrink_to_fit();
+    diagfile4_data.shrink_to_fit();
 
     // InitBaseStateGeometry(base_geom.max_radial_level, base_geom.nr_fine, base_geom.dr_fine, base_geom.nr_irreg);
     base_geom.Init(base_geom.max_radial_level, base_geom.nr_fine,
@@ -188,8 +209,20 @@ void Maestro::Setup() {
     intra.resize(max_level + 1);
     w0_cart.resize(max_level + 1);
     rhcc_for_nodalproj.resize(max_level + 1);
+    rho_omegadot.resize(max_level + 1);
+    rho_Hnuc.resize(max_level + 1);
+    burn_cost.resize(max_level + 1);
+    burn_stats.resize(max_level + 1);
+    eos_cache_old.resize(max_level + 1);
+    eos_cache_new.resize(max_level + 1);
     normal.resize(max_level + 1);
     cell_cc_to_r.resize(max_level + 1);
+    cell_radial_bin.resize(max_level + 1);
+    cell_radial_bin_fine_grids.resize(max_level + 1);
+    cc_stencil.resize(max_level + 1);
+    edge_stencil.resize(max_level + 1);
+    s0mac_stencil.resize(max_level + 1);
+    w0mac_stencil.resize(max_level + 1);
 
     // stores fluxes at coarse-fine interface for synchronization
     // this will be sized "max_level+2"
@@ -205,6 +238,9 @@ void Maestro::Setup() {
         ng_adv = 3;
     }
 
+    // scratch MultiFabs for the time step routines
+    scratch_pool.SetEnabled(use_scratch_pool);
+
     std::fill(tag_array.begin(), tag_array.end(), 0);
     // tag_array_b.setVal(0);
 
@@ -0,0 +1,365 @@
+
+#include <Maestro.H>
+#include <fstream>
+#include <iomanip>
+
+using namespace amrex;
+
+// precision and column width of diag_solver.out, as in the other diag files
+const int outfilePrecision = 10;
+const int setwVal =
+    outfilePrecision + 2 + 4 + 4;  // 0. + precision + 4 for exp + 4 for gap
+
+void Maestro::UpdateSolvers() {
+    bool same_grids = int(solver_grids.size()) == finest_level + 1;
+    for (int lev = 0; same_grids && lev <= finest_level; ++lev) {
+        same_grids = solver_grids[lev] == grids[lev] &&
+                     solver_dmap[lev] == dmap[lev];
+    }
+
+    if (same_grids) {
+        return;
+    }
+
+    // the operators live on the old grids
+    mac_mlabec.reset();
+    nodal_mlndlap.reset();
+    thermal_mlabec.reset();
+    thermal_apply_mlabec.reset();
+
+    // and so do the saved solutions
+    mac_phi_prev.clear();
+    for (auto& phi_prev : nodal_phi_prev) {
+        phi_prev.clear();
+    }
+
+    solver_grids.assign(grids.begin(), grids.begin() + finest_level + 1);
+    solver_dmap.assign(dmap.begin(), dmap.begin() + finest_level + 1);
+}
+
+MLABecLaplacian& Maestro::MacSolver() {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MacSolver()", MacSolver);
+
+    UpdateSolvers();
+
+    if (mac_mlabec) {
+        return *mac_mlabec;
+    }
+
+    LPInfo info;
+    info.setMetricTerm(false);
+
+    if (mg_bottom_solver == 4) {
+        info.setAgglomeration(true);
+        info.setConsolidation(true);
+    } else {
+        info.setAgglomeration(false);
+        info.setConsolidation(false);
+    }
+
+    // Only pass up to defined level to prevent looping over undefined grids.
+    mac_mlabec = std::make_unique<MLABecLaplacian>(Geom(0, finest_level),
+                                                   grids, dmap, info);
+
+    // order of stencil
+    int linop_maxorder = 2;
+    mac_mlabec->setMaxOrder(linop_maxorder);
+
+    // set boundaries for mlabec using velocity bc's
+    SetMacSolverBCs(*mac_mlabec);
+
+    // solve -div B grad phi = RHS
+    mac_mlabec->setScalars(0.0, 1.0);
+
+    ++mac_solver_times.builds;
+
+    return *mac_mlabec;
+}
+
+MLNodeLaplacian& Maestro::NodalSolver() {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::NodalSolver()", NodalSolver);
+
+    UpdateSolvers();
+
+    if (nodal_mlndlap) {
+        return *nodal_mlndlap;
+    }
+
+    std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_lobc;
+    std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_hibc;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        if (Geom(0).isPeriodic(idim)) {
+            mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
+        } else {
+            if (phys_bc[idim] == Outflow) {
+                mlmg_lobc[idim] = LinOpBCType::Dirichlet;
+            } else {
+                mlmg_lobc[idim] = LinOpBCType::Neumann;
+            }
+
+            if (phys_bc[AMREX_SPACEDIM + idim] == Outflow) {
+                mlmg_hibc[idim] = LinOpBCType::Dirichlet;
+            } else {
+                mlmg_hibc[idim] = LinOpBCType::Neumann;
+            }
+        }
+    }
+
+    LPInfo info;
+    info.setMetricTerm(false);
+
+    if (hg_bottom_solver == 4) {
+        info.setAgglomeration(true);
+        info.setConsolidation(true);
+    } else {
+        info.setAgglomeration(false);
+        info.setConsolidation(false);
+    }
+
+    // Only pass up to defined level to prevent looping over undefined grids.
+    nodal_mlndlap = std::make_unique<MLNodeLaplacian>(Geom(0, finest_level),
+                                                      grids, dmap, info);
+    nodal_mlndlap->setGaussSeidel(true);
+    nodal_mlndlap->setHarmonicAverage(false);
+
+    nodal_mlndlap->setDomainBC(mlmg_lobc, mlmg_hibc);
+
+    ++nodal_solver_times.builds;
+
+    return *nodal_mlndlap;
+}
+
+MLABecLaplacian& Maestro::ThermalSolver() {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::ThermalSolver()", ThermalSolver);
+
+    UpdateSolvers();
+
+    if (thermal_mlabec) {
+        return *thermal_mlabec;
+    }
+
+    LPInfo info;
+
+    // Only pass up to defined level to prevent looping over undefined grids.
+    thermal_mlabec = std::make_unique<MLABecLaplacian>(Geom(0, finest_level),
+                                                       grids, dmap, info);
+
+    // order of stencil
+    int linop_maxorder = 2;
+    thermal_mlabec->setMaxOrder(linop_maxorder);
+
+    // set boundaries for mlabec using enthalpy bc's
+    std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_lobc;
+    std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_hibc;
+
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        if (Geom(0).isPeriodic(idim)) {
+            mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
+        } else {
+            // lo-side BCs
+            if (bcs_s[RhoH].lo(idim) == BCType::foextrap) {
+                mlmg_lobc[idim] = LinOpBCType::Neumann;
+            } else if (bcs_s[RhoH].lo(idim) == BCType::ext_dir) {
+                mlmg_lobc[idim] = LinOpBCType::Dirichlet;
+            } else {
+                mlmg_lobc[idim] = LinOpBCType::Neumann;
+            }
+
+            // hi-side BCs
+            if (bcs_s[RhoH].hi(idim) == BCType::foextrap) {
+                mlmg_hibc[idim] = LinOpBCType::Neumann;
+            } else if (bcs_s[RhoH].hi(idim) == BCType::ext_dir) {
+                mlmg_hibc[idim] = LinOpBCType::Dirichlet;
+            } else {
+                mlmg_hibc[idim] = LinOpBCType::Neumann;
+            }
+        }
+    }
+
+    thermal_mlabec->setDomainBC(mlmg_lobc, mlmg_hibc);
+
+    ++thermal_solver_times.builds;
+
+    return *thermal_mlabec;
+}
+
+MLABecLaplacian& Maestro::ThermalApplyOp() {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::ThermalApplyOp()", ThermalApplyOp);
+
+    UpdateSolvers();
+
+    if (thermal_apply_mlabec) {
+        return *thermal_apply_mlabec;
+    }
+
+    LPInfo info;
+
+    // turn off multigrid coarsening since no actual solve is performed
+    info.setMaxCoarseningLevel(0);
+
+    // Only pass up to defined level to prevent looping over undefined grids.
+    thermal_apply_mlabec = std::make_unique<MLABecLaplacian>(
+        Geom(0, finest_level), grids, dmap, info);
+
+    // order of stencil
+    int stencil_order = 2;
+    thermal_apply_mlabec->setMaxOrder(stencil_order);
+
+    // compute div B grad phi; the domain BCs are set by ApplyThermal
+    thermal_apply_mlabec->setScalars(0.0, 1.0);
+
+    ++thermal_solver_times.builds;
+
+    return *thermal_apply_mlabec;
+}
+
+bool Maestro::LoadWarmStart(const Vector<MultiFab>& prev,
+                            Vector<MultiFab>& phi, const Real scale) {
+    if (int(prev.size()) != finest_level + 1) {
+        return false;
+    }
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        if (prev[lev].boxArray() != phi[lev].boxArray() ||
+            prev[lev].DistributionMap() != phi[lev].DistributionMap()) {
+            return false;
+        }
+    }
+
+    // the ghost cells are left alone since they hold the boundary values
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        MultiFab::Copy(phi[lev], prev[lev], 0, 0, 1, 0);
+        if (scale != 1.0) {
+            phi[lev].mult(scale, 0, 1, 0);
+        }
+    }
+
+    return true;
+}
+
+void Maestro::SaveWarmStart(const Vector<MultiFab>& phi,
+                            Vector<MultiFab>& prev) {
+    prev.resize(finest_level + 1);
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        if (!prev[lev].ok() || prev[lev].boxArray() != phi[lev].boxArray() ||
+            prev[lev].DistributionMap() != phi[lev].DistributionMap()) {
+            prev[lev].define(phi[lev].boxArray(), phi[lev].DistributionMap(),
+                             1, 0);
+        }
+        MultiFab::Copy(prev[lev], phi[lev], 0, 0, 1, 0);
+    }
+}
+
+void Maestro::LogSolve(const int solver, const int kind, MLMG& mlmg,
+                       const Real rel_tol, const Real setup_time,
+                       const Real solve_time) {
+    if (!do_solver_log) {
+        return;
+    }
+
+    int bottom_iters = 0;
+    for (const auto n : mlmg.getNumCGIters()) {
+        bottom_iters += n;
+    }
+
+    // the times are reduced over the ranks when the records are written
+    const Real record[nsolver_log] = {Real(istep),
+                                      t_old,
+                                      Real(solver),
+                                      Real(kind),
+                                      Real(finest_level + 1),
+                                      Real(mlmg.getNumIters()),
+                                      Real(bottom_iters),
+                                      mlmg.getInitRHS(),
+                                      mlmg.getInitResidual(),
+                                      mlmg.getFinalResidual(),
+                                      rel_tol,
+                                      setup_time,
+                                      solve_time};
+    solver_log_data.insert(solver_log_data.end(), record,
+                           record + nsolver_log);
+}
+
+void Maestro::WriteSolverLog() {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::WriteSolverLog()", WriteSolverLog);
+
+    // the setup and solve times are the max over the ranks; the other
+    // columns are the same on every rank
+    ParallelDescriptor::ReduceRealMax(solver_log_data.dataPtr(),
+                                      int(solver_log_data.size()),
+                                      ParallelDescriptor::IOProcessorNumber());
+
+    if (ParallelDescriptor::IOProcessor()) {
+        // start a new file unless we are continuing a run
+        const bool new_file = !solver_log_started && restart_file.empty();
+        std::ofstream diagfile(
+            "diag_solver.out",
+            std::ofstream::out | std::ofstream::binary |
+                (new_file ? std::ofstream::trunc : std::ofstream::app));
+
+        if (new_file) {
+            // solver: 0 = MAC, 1 = nodal, 2 = thermal
+            // kind: MAC: 1 = predictor, 2 = corrector; nodal: proj_type;
+            //       thermal: 1, or the SDC step
+            const std::string names[nsolver_log] = {
+                "step",        "time",        "solver",      "kind",
+                "nlevels",     "vcycles",     "bottom_iter", "rhs_norm",
+                "init_resid",  "final_resid", "rel_tol",     "setup_time",
+                "solve_time"};
+            for (const auto& name : names) {
+                diagfile << std::setw(setwVal) << std::left << name;
+            }
+            diagfile << std::endl;
+        }
+
+        diagfile.precision(outfilePrecision);
+        diagfile << std::scientific;
+        const int nrecords = solver_log_data.size() / nsolver_log;
+        for (auto i = 0; i < nrecords; ++i) {
+            for (auto comp = 0; comp < nsolver_log; ++comp) {
+                diagfile << std::setw(setwVal) << std::left
+                         << solver_log_data[i * nsolver_log + comp];
+            }
+            diagfile << std::endl;
+        }
+
+        diagfile.close();
+    }
+
+    solver_log_started = true;
+
+    // reset buffer array
+    solver_log_data.clear();
+}
+
+void Maestro::PrintSolverTimes() {
+    const std::string names[3] = {"MAC Proj", "Nodal Proj", "Thermal"};
+    SolverTimes* times[3] = {&mac_solver_times, &nodal_solver_times,
+                             &thermal_solver_times};
+
+    for (int n = 0; n < 3; ++n) {
+        if (times[n]->calls == 0) {
+            continue;
+        }
+
+        Real t[2] = {times[n]->setup, times[n]->solve};
+        ParallelDescriptor::ReduceRealMax(
+            t, 2, ParallelDescriptor::IOProcessorNumber());
+
+        Print() << names[n] << " solver: " << times[n]->calls << " calls, "
+                << times[n]->builds << " operator builds, setup " << t[0]
+                << " seconds, solve " << t[1] << " seconds, "
+                << times[n]->iters << " MLMG iterations";
+        if (times[n]->warm_starts > 0) {
+            Print() << " (" << times[n]->warm_starts << " warm starts)";
+        }
+        Print() << std::endl;
+
+        *times[n] = SolverTimes();
+    }
+}
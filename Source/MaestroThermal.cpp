@@ -1,6 +1,7 @@
 
 #include <AMReX_VisMF.H>
 #include <Maestro.H>
+#include <MaestroEos.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
@@ -41,17 +42,7 @@ void Maestro::MakeExplicitThermal(
     //
     // Compute thermal = div B grad phi using MLABecLaplacian class
     //
-    LPInfo info;
-
-    // turn off multigrid coarsening since no actual solve is performed
-    info.setMaxCoarseningLevel(0);
-
-    // Only pass up to defined level to prevent looping over undefined grids.
-    MLABecLaplacian mlabec(Geom(0, finest_level), grids, dmap, info);
-
-    // order of stencil
-    int stencil_order = 2;
-    mlabec.setMaxOrder(stencil_order);
+    MLABecLaplacian& mlabec = ThermalApplyOp();
 
     if (temp_formulation == 1) {
         // compute div Tcoeff grad T
@@ -155,17 +146,7 @@ void Maestro::MakeExplicitThermalHterm(Vector<MultiFab>& thermal,
     //
     // Compute thermal = div B grad phi using MLABecLaplacian class
     //
-    LPInfo info;
-
-    // turn off multigrid coarsening since no actual solve is performed
-    info.setMaxCoarseningLevel(0);
-
-    // Only pass up to defined level to prevent looping over undefined grids.
-    MLABecLaplacian mlabec(Geom(0, finest_level), grids, dmap, info);
-
-    // order of stencil
-    int stencil_order = 2;
-    mlabec.setMaxOrder(stencil_order);
+    MLABecLaplacian& mlabec = ThermalApplyOp();
 
     // 1. Compute div hcoeff grad h
     mlabec.setScalars(0.0, 1.0);
@@ -194,6 +175,8 @@ void Maestro::ApplyThermal(MLABecLaplacian& mlabec,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::ApplyThermal()", ApplyThermal);
 
+    Real setup_start = ParallelDescriptor::second();
+
     // build array of boundary conditions needed by MLABecLaplacian
     std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_lobc;
     std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_hibc;
@@ -259,7 +242,13 @@ void Maestro::ApplyThermal(MLABecLaplacian& mlabec,
     // build an MLMG solver
     MLMG thermal_mlmg(mlabec);
 
+    Real solve_start = ParallelDescriptor::second();
+    thermal_solver_times.setup += solve_start - setup_start;
+
     thermal_mlmg.apply(GetVecOfPtrs(thermalout), GetVecOfPtrs(phi));
+
+    thermal_solver_times.solve += ParallelDescriptor::second() - solve_start;
+    ++thermal_solver_times.calls;
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -274,6 +263,11 @@ void Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeThermalCoeffs()", MakeThermalCoeffs);
 
+    // the EOS fields of scal, if they are cached
+    const Vector<MultiFab>* eos_cache = GetEosCache(
+        scal, {EosCache_conductivity, EosCache_cp, EosCache_p, EosCache_dpdr,
+               EosCache_dedr, EosCache_dhdX});
+
     for (int lev = 0; lev <= finest_level; ++lev) {
         Print() << "... Level " << lev
                 << " create thermal coeffs:" << std::endl;
@@ -295,36 +289,31 @@ void Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
             const Array4<Real> pcoeff_arr = pcoeff[lev].array(mfi);
             const Array4<Real> Xkcoeff_arr = Xkcoeff[lev].array(mfi);
             const Array4<const Real> scal_arr = scal[lev].array(mfi);
-
-            ParallelFor(gtbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                if (limit_conductivity_l &&
-                    scal_arr(i, j, k, Rho) <
-                        buoyancy_cutoff_factor_l * base_cutoff_density_l) {
-                    Tcoeff_arr(i, j, k) = 0.0;
-                    hcoeff_arr(i, j, k) = 0.0;
-                    pcoeff_arr(i, j, k) = 0.0;
-                    for (auto comp = 0; comp < NumSpec; ++comp) {
-                        Xkcoeff_arr(i, j, k, comp) = 0.0;
-                    }
-                } else {
-                    eos_t eos_state;
-                    eos_state.rho = scal_arr(i, j, k, Rho);
-                    eos_state.T = scal_arr(i, j, k, Temp);
-                    for (auto comp = 0; comp < NumSpec; ++comp) {
-                        eos_state.xn[comp] =
-                            scal_arr(i, j, k, FirstSpec + comp) / eos_state.rho;
-                    }
-#if NAUX_NET > 0
-                    for (auto comp = 0; comp < NumAux; ++comp) {
-                        eos_state.aux[comp] =
-                            scal_arr(i, j, k, FirstAux + comp) / eos_state.rho;
+            const Array4<const Real> cache_arr =
+                eos_cache ? (*eos_cache)[lev].const_array(mfi)
+                          : Array4<const Real>{};
+
+            // dens, temp and xmass are inputs
+            EosDerivSweep(
+                gtbx, scal_arr, cache_arr, eos_cache_idx, true, true,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                    if (limit_conductivity_l &&
+                        scal_arr(i, j, k, Rho) <
+                            buoyancy_cutoff_factor_l * base_cutoff_density_l) {
+                        // no conduction here, so skip the EOS call
+                        Tcoeff_arr(i, j, k) = 0.0;
+                        hcoeff_arr(i, j, k) = 0.0;
+                        pcoeff_arr(i, j, k) = 0.0;
+                        for (auto comp = 0; comp < NumSpec; ++comp) {
+                            Xkcoeff_arr(i, j, k, comp) = 0.0;
+                        }
+                        return false;
                     }
-#endif
-
-                    // dens, temp and xmass are inputs
-                    eos(eos_input_rt, eos_state);
-                    conductivity(eos_state);
-
+                    return true;
+                },
+                [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                     const eos_t& eos_state,
+                                     const eos_xderivs_t& eos_xderivs) {
                     Tcoeff_arr(i, j, k) = -eos_state.conductivity;
                     hcoeff_arr(i, j, k) =
                         -eos_state.conductivity / eos_state.cp;
@@ -335,15 +324,12 @@ void Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
                               eos_state.p / (eos_state.rho * eos_state.dpdr)) +
                          eos_state.dedr / eos_state.dpdr);
 
-                    const auto eos_xderivs = composition_derivatives(eos_state);
-
                     for (auto comp = 0; comp < NumSpec; ++comp) {
                         Xkcoeff_arr(i, j, k, comp) = eos_state.conductivity /
                                                      eos_state.cp *
                                                      eos_xderivs.dhdX[comp];
                     }
-                }
-            });
+                });
         }
     }
 }
@@ -437,46 +423,12 @@ void Maestro::ThermalConduct(const Vector<MultiFab>& s1, Vector<MultiFab>& s2,
     }
 
     //
-    // Set up implicit solve using MLABecLaplacian class
+    // Set up implicit solve using MLABecLaplacian class.  The operator is
+    // kept across calls, so only its coefficients are set here.
     //
-    LPInfo info;
-
-    // Only pass up to defined level to prevent looping over undefined grids.
-    MLABecLaplacian mlabec(Geom(0, finest_level), grids, dmap, info);
+    Real setup_start = ParallelDescriptor::second();
 
-    // order of stencil
-    int linop_maxorder = 2;
-    mlabec.setMaxOrder(linop_maxorder);
-
-    // set boundaries for mlabec using enthalpy bc's
-    std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_lobc;
-    std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_hibc;
-
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-        if (Geom(0).isPeriodic(idim)) {
-            mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
-        } else {
-            // lo-side BCs
-            if (bcs_s[RhoH].lo(idim) == BCType::foextrap) {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            } else if (bcs_s[RhoH].lo(idim) == BCType::ext_dir) {
-                mlmg_lobc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            }
-
-            // hi-side BCs
-            if (bcs_s[RhoH].hi(idim) == BCType::foextrap) {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            } else if (bcs_s[RhoH].hi(idim) == BCType::ext_dir) {
-                mlmg_hibc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            }
-        }
-    }
-
-    mlabec.setDomainBC(mlmg_lobc, mlmg_hibc);
+    MLABecLaplacian& mlabec = ThermalSolver();
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         mlabec.setLevelBC(lev, &phi[lev]);
@@ -506,10 +458,21 @@ void Maestro::ThermalConduct(const Vector<MultiFab>& s1, Vector<MultiFab>& s2,
     const Real solver_tol_abs = eps_mac * thermal_tol_abs;
     const Real solver_tol_rel = eps_mac;
 
+    Real solve_start = ParallelDescriptor::second();
+    thermal_solver_times.setup += solve_start - setup_start;
+
     // solve for phi
     thermal_mlmg.solve(GetVecOfPtrs(phi), GetVecOfConstPtrs(solverrhs),
                        solver_tol_rel, solver_tol_abs);
 
+    const Real solve_time = ParallelDescriptor::second() - solve_start;
+    thermal_solver_times.solve += solve_time;
+    ++thermal_solver_times.calls;
+    thermal_solver_times.iters += thermal_mlmg.getNumIters();
+
+    LogSolve(SolverLog_thermal, 1, thermal_mlmg, solver_tol_rel,
+             solve_start - setup_start, solve_time);
+
     // load new rho*h into s2
     for (int lev = 0; lev <= finest_level; ++lev) {
         MultiFab::Copy(s2[lev], phi[lev], 0, RhoH, 1, 1);
@@ -631,46 +594,12 @@ void Maestro::ThermalConductSDC(
     }
 
     //
-    // Set up implicit solve using MLABecLaplacian class
+    // Set up implicit solve using MLABecLaplacian class.  The operator is
+    // kept across calls, so only its coefficients are set here.
     //
-    LPInfo info;
-
-    // Only pass up to defined level to prevent looping over undefined grids.
-    MLABecLaplacian mlabec(Geom(0, finest_level), grids, dmap, info);
-
-    // order of stencil
-    int linop_maxorder = 2;
-    mlabec.setMaxOrder(linop_maxorder);
-
-    // set boundaries for mlabec using enthalpy bc's
-    std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_lobc;
-    std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_hibc;
-
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-        if (Geom(0).isPeriodic(idim)) {
-            mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
-        } else {
-            // lo-side BCs
-            if (bcs_s[RhoH].lo(idim) == BCType::foextrap) {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            } else if (bcs_s[RhoH].lo(idim) == BCType::ext_dir) {
-                mlmg_lobc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            }
+    Real setup_start = ParallelDescriptor::second();
 
-            // hi-side BCs
-            if (bcs_s[RhoH].hi(idim) == BCType::foextrap) {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            } else if (bcs_s[RhoH].hi(idim) == BCType::ext_dir) {
-                mlmg_hibc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            }
-        }
-    }
-
-    mlabec.setDomainBC(mlmg_lobc, mlmg_hibc);
+    MLABecLaplacian& mlabec = ThermalSolver();
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         mlabec.setLevelBC(lev, &phi[lev]);
@@ -705,10 +634,21 @@ void Maestro::ThermalConductSDC(
     const Real solver_tol_abs = eps_mac * thermal_tol_abs;
     const Real solver_tol_rel = eps_mac;
 
+    Real solve_start = ParallelDescriptor::second();
+    thermal_solver_times.setup += solve_start - setup_start;
+
     // solve for phi
     thermal_mlmg.solve(GetVecOfPtrs(phi), GetVecOfConstPtrs(solverrhs),
                        solver_tol_rel, solver_tol_abs);
 
+    const Real solve_time = ParallelDescriptor::second() - solve_start;
+    thermal_solver_times.solve += solve_time;
+    ++thermal_solver_times.calls;
+    thermal_solver_times.iters += thermal_mlmg.getNumIters();
+
+    LogSolve(SolverLog_thermal, which_step, thermal_mlmg, solver_tol_rel,
+             solve_start - setup_start, solve_time);
+
     // load new rho*h into s2
     for (int lev = 0; lev <= finest_level; ++lev) {
         MultiFab::Copy(s_hat[lev], phi[lev], 0, RhoH, 1, 1);
@@ -0,0 +1,93 @@
+#include <MultiFabPool.H>
+
+using namespace amrex;
+
+void MultiFabPool::Define(MultiFab& mf, const BoxArray& ba,
+                          const DistributionMapping& dm, const int ncomp,
+                          const int ngrow) {
+    // timer for profiling
+    BL_PROFILE_VAR("MultiFabPool::Define()", Define);
+
+    if (!enabled) {
+        mf.define(ba, dm, ncomp, ngrow);
+        return;
+    }
+
+    // if mf is already holding pooled data, give it back first
+    if (mf.ok()) {
+        Return(mf);
+    }
+
+    const IntVect ng(ngrow);
+
+    // look for a free MultiFab with the same layout
+    auto it = free_mfs.begin();
+    for (; it != free_mfs.end(); ++it) {
+        if (it->nComp() == ncomp && it->nGrowVect() == ng &&
+            it->ixType() == ba.ixType() && it->boxArray() == ba &&
+            it->DistributionMap() == dm) {
+            break;
+        }
+    }
+
+    if (it != free_mfs.end()) {
+        mf = std::move(*it);
+        free_mfs.erase(it);
+    } else {
+        mf.define(ba, dm, ncomp, ngrow);
+        num_total++;
+        bytes_total += LocalBytes(mf);
+    }
+
+    num_in_use++;
+    bytes_in_use += LocalBytes(mf);
+    num_high_water = amrex::max(num_high_water, num_in_use);
+    bytes_high_water = amrex::max(bytes_high_water, bytes_in_use);
+}
+
+void MultiFabPool::Return(MultiFab& mf) {
+    if (!enabled || !mf.ok()) {
+        return;
+    }
+
+    num_in_use = amrex::max(num_in_use - 1, 0);
+    bytes_in_use = amrex::max(bytes_in_use - LocalBytes(mf), Long(0));
+
+    free_mfs.push_back(std::move(mf));
+}
+
+void MultiFabPool::Clear() {
+    free_mfs.clear();
+
+    // anything still on loan now belongs to its owner
+    generation++;
+    num_total = 0;
+    num_in_use = 0;
+    bytes_total = 0;
+    bytes_in_use = 0;
+}
+
+void MultiFabPool::PrintStats() const {
+    if (!enabled) {
+        return;
+    }
+
+    Long stats[4] = {Long(num_total), bytes_total, Long(num_high_water),
+                     bytes_high_water};
+    ParallelDescriptor::ReduceLongMax(stats, 4,
+                                      ParallelDescriptor::IOProcessorNumber());
+
+    const Real MB = 1024. * 1024.;
+    Print() << "Scratch MultiFab pool: " << stats[0] << " MultiFabs ("
+            << stats[1] / MB << " MB) allocated, high-water mark " << stats[2]
+            << " MultiFabs (" << stats[3] / MB << " MB) in use"
+            << " (max over ranks)" << std::endl;
+}
+
+Long MultiFabPool::LocalBytes(const MultiFab& mf) {
+    Long bytes = 0;
+    for (MFIter mfi(mf, false); mfi.isValid(); ++mfi) {
+        bytes += mf[mfi].nBytes();
+    }
+    return bytes;
+}